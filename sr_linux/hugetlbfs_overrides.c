@@ -46,6 +46,16 @@
 #include "gtm_limits.h"
 #include "restrict.h"	/* Needed for restrictions */
 #include "have_crit.h"	/* Needed for defer interrupts */
+#include <sys/syscall.h>
+
+#define	NUMA_MAX_NODES		1024	/* bits in the node masks passed to get_mempolicy and mbind */
+#define	NUMA_MASK_LONGS		(NUMA_MAX_NODES / (BITS_PER_UCHAR * SIZEOF(unsigned long)))
+#ifndef MPOL_INTERLEAVE
+#	define	MPOL_INTERLEAVE		3	/* from <numaif.h>, which is not always installed */
+#endif
+#ifndef MPOL_F_MEMS_ALLOWED
+#	define	MPOL_F_MEMS_ALLOWED	(1 << 2)
+#endif
 
 GBLREF char	 ydb_dist[GTM_PATH_MAX];
 GBLDEF long	 gtm_os_hugepage_size = -1;	/* Default Huge Page size of OS. If huge pages are not supported or the
@@ -138,3 +148,27 @@ void libhugetlbfs_init(void)
 	assert(0 == (gtm_os_hugepage_size % OS_PAGE_SIZE));	/* huge pages sizes are multiples of page sizes */
 	hugetlb_is_attempted = TRUE;
 }
+
+/* Spreads the pages of the shared memory segment at "addr" round robin across the NUMA nodes this process may allocate
+ * memory on (MUPIP SET -NUMA_INTERLEAVE), so that on a multi-socket host the global buffers are not all local to the socket of
+ * the process that happened to create the segment. Must be called before anything touches the segment. Since it is only a
+ * placement hint, failures are ignored. Returns the number of nodes the segment is interleaved across, 0 if it is not.
+ */
+int shm_numa_interleave(void *addr, size_t len)
+{
+	unsigned long	nodemask[NUMA_MASK_LONGS], bits;
+	int		i, mode, nodes;
+
+	memset(nodemask, 0, SIZEOF(nodemask));
+	if (-1 == syscall(SYS_get_mempolicy, &mode, nodemask, (unsigned long)NUMA_MAX_NODES, NULL, MPOL_F_MEMS_ALLOWED))
+		return 0;
+	for (nodes = 0, i = 0; i < NUMA_MASK_LONGS; i++)
+		for (bits = nodemask[i]; bits; bits &= bits - 1)
+			nodes++;
+	if (2 > nodes)
+		return 0;
+	/* Unlike get_mempolicy, mbind takes one more than the number of bits in the mask */
+	if (-1 == syscall(SYS_mbind, addr, len, MPOL_INTERLEAVE, nodemask, (unsigned long)NUMA_MAX_NODES + 1, 0))
+		return 0;
+	return nodes;
+}
@@ -268,7 +268,8 @@ void clear_fake_enospc_if_master_dead(void);
 {											\
 	GBLREF	jnlpool_addrs_ptr_t	jnlpool;					\
 		jnlpool_addrs_ptr_t	local_jnlpool;					\
-	node_local_ptr_t		cnl;						\
+	node_local_ptr_t		cnl = NULL;					\
+	gtm_uint64_t			lat_start = 0;					\
 											\
 	local_jnlpool = JNLPOOL_FROM(CSA);						\
 	assert(CSA || (!local_jnlpool || !local_jnlpool->jnlpool_ctl));			\
@@ -277,9 +278,14 @@ void clear_fake_enospc_if_master_dead(void);
 		WAIT_FOR_REPL_INST_UNFREEZE_SAFE(CSA);					\
 		cnl = (CSA)->nl;							\
 		if (NULL != cnl)							\
+		{									\
 			INCR_GVSTATS_COUNTER((CSA), cnl, n_jnl_fsync, 1);		\
+			GVSTATS_LAT_START(lat_start);					\
+		}									\
 	}										\
 	GTM_FSYNC(FD, RC);								\
+	if (lat_start)									\
+		GVSTATS_LAT_END((CSA), lat_jnl_fsync, lat_start);			\
 }
 
 #define GTM_REPL_INST_FSYNC(FD, RC)	GTM_FSYNC(FD, RC)
@@ -183,7 +183,8 @@ block_id bm_getfree(block_id hint, boolean_t *blk_used, unsigned int cw_work, cw
 				rdfail_detail = cdb_sc_badbitmap;
 				return MAP_RD_FAIL;
 			}
-			offset = 0;
+			/* With MUPIP SET -CLUSTER_BLOCKS, start looking at the hint so the block lands in the global's cluster */
+			offset = (cs_data->alloc_cluster && (hint > bml)) ? (hint - bml) : 0;
 		} else
 		{
 			bmp = cs1->old_block;
@@ -196,6 +197,12 @@ block_id bm_getfree(block_id hint, boolean_t *blk_used, unsigned int cw_work, cw
 			free_bit = bm_find_blk(offset, (sm_uc_ptr_t)bmp + SIZEOF(blk_hdr), map_size, blk_used);
 			if (MAP_RD_FAIL == free_bit)
 				return MAP_RD_FAIL;
+			if ((NO_FREE_SPACE == free_bit) && (0 == depth) && offset)
+			{	/* nothing free after the cluster hint; take the first free block in the map as usual */
+				free_bit = bm_find_blk(0, (sm_uc_ptr_t)bmp + SIZEOF(blk_hdr), map_size, blk_used);
+				if (MAP_RD_FAIL == free_bit)
+					return MAP_RD_FAIL;
+			}
 		} else
 			free_bit = NO_FREE_SPACE;
 		if (NO_FREE_SPACE != free_bit)
@@ -300,3 +307,47 @@ boolean_t	is_free_blks_ctr_ok(void)
 	}
 	return TRUE;
 }
+
+/* With MUPIP SET -CLUSTER_BLOCKS=n (csd->alloc_cluster), blocks created by splits of one global are kept physically together
+ * so that a range scan of it reads runs of adjacent blocks. The file is viewed as aligned runs (clusters) of n blocks. A global
+ * keeps allocating after the block it last got (gvt->alloc_next) until that reaches a cluster boundary, and then claims the
+ * next cluster from a region wide cursor (cnl->alloc_cluster_next), so globals growing at the same time get different clusters
+ * instead of interleaving their blocks. Nothing is actually reserved in the bitmaps: the result is only a hint for bm_getfree
+ * which still takes the first free block at or after it, and the cursor is moved past whatever block bm_getfree picks (see
+ * bm_cluster_note). In TP this runs outside crit so two processes may occasionally claim the same cluster, which only costs
+ * locality. Returns "hint" unchanged if the policy is off or there is no global to attribute the block to.
+ */
+block_id	bm_cluster_hint(gv_namehead *gvt, block_id hint)
+{
+	block_id		next;
+	node_local_ptr_t	cnl;
+	uint4			cluster, total_blks;
+
+	cluster = cs_data->alloc_cluster;
+	if (!cluster || (NULL == gvt))
+		return hint;
+	if (gvt->alloc_next && (gvt->alloc_next % cluster))
+		return gvt->alloc_next;
+	cnl = cs_addrs->nl;
+	total_blks = (dba_mm == cs_data->acc_meth) ? cs_addrs->total_blks : cs_addrs->ti->total_blks;
+	next = cnl->alloc_cluster_next;
+	if ((0 == next) || ((uint4)next >= total_blks))
+		next = (hint / cluster) * cluster;	/* first claim or wrapped: go back to the region's default hint */
+	cnl->alloc_cluster_next = next + cluster;
+	return next ? next : 1;
+}
+
+/* Records that block "blk" was just allocated for global "gvt" (see bm_cluster_hint) */
+void	bm_cluster_note(gv_namehead *gvt, block_id blk)
+{
+	node_local_ptr_t	cnl;
+	uint4			cluster;
+
+	cluster = cs_data->alloc_cluster;
+	if (!cluster || (NULL == gvt))
+		return;
+	gvt->alloc_next = blk + 1;
+	cnl = cs_addrs->nl;
+	if (blk >= cnl->alloc_cluster_next)
+		cnl->alloc_cluster_next = DIVIDE_ROUND_UP(blk + 1, cluster) * cluster;
+}
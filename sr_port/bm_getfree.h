@@ -14,5 +14,7 @@
 
 block_id bm_getfree(block_id orig_hint, boolean_t *blk_used, unsigned int cw_work, cw_set_element *cs, int *cw_depth_ptr);
 boolean_t	is_free_blks_ctr_ok(void);
+block_id	bm_cluster_hint(gv_namehead *gvt, block_id hint);
+void		bm_cluster_note(gv_namehead *gvt, block_id blk);
 
 #endif /* BM_GETFREE_INCLUDED */
@@ -32,6 +32,10 @@ typedef struct cache_ent
 	icode_str	src;
 	int		refcnt;			/* Number of indirect source code pointing to same cache entry */
 	int		zb_refcnt;		/* Number of zbreak action entry pointing to same cache entry */
+	struct
+	{
+		struct cache_ent	*fl, *bl;
+	} lru;					/* Position in cache_lru_queue (most recently used at the head) */
 } cache_entry;
 
 /* Following is the indirect routine header build as part of an indirect code object */
@@ -49,19 +53,32 @@ typedef struct ihead_struct
 #define ICACHE_TABLE_INIT_SIZE 	64	/* Use 1K memory initially */
 #define ICACHE_SIZE 		ROUND_UP2(SIZEOF(cache_entry), NATIVE_WSIZE)
 
-/* We allow cache_table to grow till we hit memory or entry maximums. If more memory is needed, we do compaction.
- * Current default limits (overrideable by environment variable): 128 entries, 128KB of object code on all platforms
- * except IA64 architecture which gets 256KB due to its less compact instruction forms.
+/* We allow cache_table to grow till we hit memory or entry maximums. Once either is exceeded, the least recently used
+ * entries that are not in use are evicted until we are back under the limits (see cache_table_evict()).
+ * Current default limits (overrideable by environment variable): 1024 entries, 1MB of object code.
  */
-#define DEFAULT_INDRCACHE_KBSIZE	128
-#define MAX_INDRCACHE_KBSIZE		2048
-#define DEFAULT_INRDCACHE_ENTRIES	128
+#define DEFAULT_INDRCACHE_KBSIZE	1024
+#define MAX_INDRCACHE_KBSIZE		16384
+#define DEFAULT_INRDCACHE_ENTRIES	1024
+
+/* Move a cache entry to the most recently used end of the LRU queue */
+#define CACHE_LRU_TOUCH(CSP)					\
+{								\
+	GBLREF	cache_entry	cache_lru_queue;		\
+								\
+	if (cache_lru_queue.lru.fl != (CSP))			\
+	{							\
+		dqdel((CSP), lru);				\
+		dqins(&cache_lru_queue, lru, (CSP));		\
+	}							\
+}
 
 void indir_lits(ihdtyp *ihead);
 void cache_init(void);
 mstr *cache_get(icode_str *indir_src);
 void cache_put(icode_str *src, mstr *object);
 void cache_table_rebuild(void);
+void cache_table_evict(void);
 void cache_stats(void);
 
 #endif
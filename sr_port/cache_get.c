@@ -13,6 +13,7 @@
 
 #include "cache.h"
 #include "hashtab_objcode.h"
+#include "mdq.h"
 
 GBLREF	int			cache_hits, cache_fails;
 GBLREF	hash_table_objcode	cache_table;
@@ -30,7 +31,9 @@ mstr *cache_get(icode_str *indir_src)
 	if (NULL != (tabent = lookup_hashtab_objcode(&cache_table, indir_src)))
 	{
 		cache_hits++;
-		return &(((cache_entry *)tabent->value)->obj);
+		csp = (cache_entry *)tabent->value;
+		CACHE_LRU_TOUCH(csp);
+		return &csp->obj;
 	} else
 	{
 		cache_fails++;
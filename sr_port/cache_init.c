@@ -13,12 +13,15 @@
 #include "cache.h"
 #include "hashtab_objcode.h"
 #include "hashtab.h"
+#include "mdq.h"
 
 GBLREF hash_table_objcode	cache_table;
 GBLREF	int			indir_cache_mem_size;
+GBLREF	cache_entry		cache_lru_queue;
 
 void cache_init(void)
 {
 	init_hashtab_objcode(&cache_table, ICACHE_TABLE_INIT_SIZE, HASHTAB_COMPACT, HASHTAB_SPARE_TABLE);
 	indir_cache_mem_size = 0;
+	dqinit(&cache_lru_queue, lru);
 }
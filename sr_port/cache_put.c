@@ -21,11 +21,13 @@
 #include "cacheflush.h"
 #include "gtm_text_alloc.h"
 #include "io.h"
+#include "mdq.h"
 
 GBLREF	hash_table_objcode	cache_table;
 GBLREF	int			indir_cache_mem_size;
 GBLREF  uint4           	max_cache_memsize;      /* Maximum bytes used for indirect cache object code */
 GBLREF  uint4           	max_cache_entries;      /* Maximum number of cached indirect compilations */
+GBLREF	cache_entry		cache_lru_queue;
 
 void cache_put(icode_str *src, mstr *object)
 {
@@ -38,7 +40,7 @@ void cache_put(icode_str *src, mstr *object)
 
 	indir_cache_mem_size += (ICACHE_SIZE + object->len);
 	if (indir_cache_mem_size > max_cache_memsize || cache_table.count > max_cache_entries)
-		cache_table_rebuild();
+		cache_table_evict();
 	csp = (cache_entry *)GTM_TEXT_ALLOC(ICACHE_SIZE + object->len);
 	csp->obj.addr = (char *)csp + ICACHE_SIZE;
 	csp->refcnt = csp->zb_refcnt = 0;
@@ -48,6 +50,7 @@ void cache_put(icode_str *src, mstr *object)
 	((ihdtyp *)(csp->obj.addr))->indce = csp;	/* Set backward link to this cache entry */
 	added = add_hashtab_objcode(&cache_table, &csp->src, csp, &tabent);
 	assert(added);
+	dqins(&cache_lru_queue, lru, csp);
 	DBGCACHE((stdout, "cache_put: Added to cache lookaside %d bytes - (%d/%d/%d %d/%d) code: %d  src: %.*s\n",
 		  ICACHE_SIZE + object->len, cache_table.count, cache_table.size, max_cache_entries,
 		  indir_cache_mem_size, max_cache_memsize, src->code, src->str.len, src->str.addr));
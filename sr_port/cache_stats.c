@@ -19,7 +19,7 @@
 #include "cache.h"
 #include "hashtab_objcode.h"
 
-GBLREF int			cache_hits, cache_fails;
+GBLREF int			cache_hits, cache_fails, cache_evicts;
 GBLREF	hash_table_objcode	cache_table;
 
 void cache_stats(void)
@@ -40,6 +40,6 @@ void cache_stats(void)
 				++ace;
 		}
 	}
-	FPRINTF(stderr,"Indirect cache entries currently marked active: %d\n", ace);
+	FPRINTF(stderr,"Indirect cache entries currently marked active: %d, Evictions: %d\n", ace, cache_evicts);
 }
 
@@ -23,9 +23,14 @@
 #include "cachectl.h"
 #include "gtm_text_alloc.h"
 #include "error.h"
+#include "mdq.h"
 
 GBLREF	hash_table_objcode	cache_table;
 GBLREF	int			indir_cache_mem_size;
+GBLREF	int			cache_evicts;
+GBLREF	uint4			max_cache_memsize;
+GBLREF	uint4			max_cache_entries;
+GBLREF	cache_entry		cache_lru_queue;
 
 error_def(ERR_MEMORY);
 
@@ -43,6 +48,7 @@ void cache_table_rebuild()
 			{
 				((ihdtyp *)(csp->obj.addr))->indce = NULL;
 				indir_cache_mem_size -= (ICACHE_SIZE + csp->obj.len);
+				dqdel(csp, lru);
 				GTM_TEXT_FREE(csp);
 				delete_hashtab_ent_objcode(&cache_table, tabent);
 			}
@@ -54,3 +60,32 @@ void cache_table_rebuild()
 	if (COMPACT_NEEDED(&cache_table) && (error_condition != ERR_MEMORY))
 		compact_hashtab_objcode(&cache_table);
 }
+
+/* Called by cache_put() when the cache has grown past its memory or entry limits. Unlike cache_table_rebuild(), which
+ * throws away every unused entry, this walks the LRU queue from its cold end and evicts only as many unused entries as
+ * it takes to get back under the limits, so a working set larger than the limits does not flush the hot entries.
+ */
+void cache_table_evict()
+{
+	cache_entry	*csp, *prev;
+	boolean_t	deleted;
+
+	for (csp = cache_lru_queue.lru.bl; (&cache_lru_queue != csp)
+		     && ((indir_cache_mem_size > max_cache_memsize) || (cache_table.count > max_cache_entries)); csp = prev)
+	{
+		prev = csp->lru.bl;
+		if ((0 != csp->refcnt) || (0 != csp->zb_refcnt))
+			continue;
+		DBGCACHE((stdout, "cache_table_evict: Evicting entry 0x"lvaddr" src: %.*s\n", csp, csp->src.str.len,
+			  csp->src.str.addr));
+		((ihdtyp *)(csp->obj.addr))->indce = NULL;
+		indir_cache_mem_size -= (ICACHE_SIZE + csp->obj.len);
+		dqdel(csp, lru);
+		deleted = delete_hashtab_objcode(&cache_table, &csp->src);
+		assert(deleted);
+		GTM_TEXT_FREE(csp);
+		cache_evicts++;
+	}
+	if (COMPACT_NEEDED(&cache_table) && (error_condition != ERR_MEMORY))
+		compact_hashtab_objcode(&cache_table);
+}
@@ -221,6 +221,7 @@ LITDEF struct
 		DECREMENT_EXPR_DEPTH;				/* in case of prior errors */
 	(TREF(side_effect_base))[0] = FALSE;
 	TREF(temp_subs) = FALSE;
+	TREF(cmd_xfer_uncond) = FALSE;
 	CHKTCHAIN(TREF(curtchain), exorder, FALSE);
 	TREF(pos_in_chain) = *TREF(curtchain);
 	if (TREF(window_token) != TK_IDENT)
@@ -312,8 +313,11 @@ LITDEF struct
 			}
 		}
 	}
+	if ((NULL != cr) || (EXPR_FAIL == rval))
+		TREF(cmd_xfer_uncond) = FALSE;			/* m_quit/m_goto only know about their own arguments */
 	if (NULL != oldchain)
 	{	/* for a literal 0 postconditional, we just throw the command & args away and return happiness */
+		TREF(cmd_xfer_uncond) = FALSE;
 		setcurtchain(oldchain);
 		return TRUE;
 	}
@@ -96,7 +96,7 @@ cache_rec_ptr_t	db_csh_getn(block_id block)
 	sgmnt_data_ptr_t	csd;
 	srch_blk_status		*tp_srch_status;
 	ht_ent_int4		*tabent;
-	boolean_t		asyncio, dont_flush_buff;
+	boolean_t		asyncio, dont_flush_buff, scan_resistant;
 	intrpt_state_t		prev_intrpt_state;
 #	ifdef DEBUG
 	cache_rec_ptr_t		cr_old;
@@ -146,6 +146,7 @@ cache_rec_ptr_t	db_csh_getn(block_id block)
 			&& (DBG_ASSERT(!csa->jnlpool || (csa->jnlpool == jnlpool)) IS_REPL_INST_FROZEN));
 	INCR_DB_CSH_COUNTER(csa, n_db_csh_getns, 1);
 	asyncio = csd->asyncio;
+	scan_resistant = csd->scan_resistant;
 	DEFER_INTERRUPTS(INTRPT_IN_DB_CSH_GETN, prev_intrpt_state);
 	for (lcnt = 0;  ; lcnt++)
 	{
@@ -224,6 +225,13 @@ cache_rec_ptr_t	db_csh_getn(block_id block)
 			cr->refer = FALSE;
 			continue;
 		}
+		if (scan_resistant && (lcnt < pass1) && (CR_BLKEMPTY != cr->blk)
+				&& ((blk_hdr_ptr_t)GDS_REL2ABS(cr->buffaddr))->levl)
+		{	/* MUPIP SET -SCAN_RESISTANT: in pass 1, leave index (and bitmap) blocks alone even if not referred to since
+			 * the last sweep. They are few and needed by every search, so data blocks go first.
+			 */
+			continue;
+		}
 		if (cr->in_cw_set || cr->in_tend)
 		{	/* some process already has this pinned for reading and/or updating. skip it. */
 			cr->refer = TRUE;
@@ -445,7 +453,13 @@ cache_rec_ptr_t	db_csh_getn(block_id block)
 		SHM_WRITE_MEMORY_BARRIER;
 		cr->cycle++;
 		cr->jnl_addr = 0;
-		cr->refer = TRUE;
+		/* With MUPIP SET -SCAN_RESISTANT, a block read in starts on probation: it does not have its refer bit set and
+		 * so is the first to go when the clock hand comes around unless some process looks it up again in the
+		 * meantime (db_csh_get). That way blocks touched just once by a scan (MUPIP EXTRACT, a $ORDER loop over a
+		 * big global) do not push blocks in repeated use out of the cache. Since the hand has just moved past this
+		 * record, a full sweep has to happen before it is considered again, which is time enough for the reader.
+		 */
+		cr->refer = !scan_resistant;
 		if (cr->bt_index != 0)
 		{	/* Link between "cr" and "bt" was established at the time this "cr" was dirtied first and continued
 			 * to stay even when cr->dirty became 0. But now that this "cr" is going to point to a different block
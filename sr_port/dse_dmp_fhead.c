@@ -74,10 +74,24 @@ LITREF	char		*gtm_dbversion_table[];
 				(csd->COUNTER.cumul_count + csd->COUNTER.curr_count));			\
 	}
 
-#define SHOW_GVSTATS_STAT(cnl, COUNTER, TEXT1, TEXT2)							\
+#define SHOW_GVSTATS_STAT(GVSTATS, COUNTER, TEXT1, TEXT2)						\
 {													\
-	if (cnl->gvstats_rec.COUNTER)									\
-		util_out_print("  " TEXT1 " : " TEXT2"  0x!16@XQ", TRUE, (&cnl->gvstats_rec.COUNTER));	\
+	if ((GVSTATS).COUNTER)										\
+		util_out_print("  " TEXT1 " : " TEXT2"  0x!16@XQ", TRUE, (&(GVSTATS).COUNTER));	\
+}
+
+#define SHOW_GVSTATS_LAT(LAT, TEXT1, TEXT2)									\
+{															\
+	int	bucket;													\
+															\
+	for (bucket = 0; bucket < GVSTATS_LAT_BUCKETS; bucket++)							\
+	{														\
+		if ((LAT).bucket[bucket])										\
+			util_out_print("  " TEXT1 " : " TEXT2" >= !10UL us  0x!16@XQ", TRUE,				\
+				(bucket ? (1 << (bucket - 1)) : 0), &(LAT).bucket[bucket]);				\
+	}														\
+	if ((LAT).sum_usec)												\
+		util_out_print("  " TEXT1 " : " TEXT2"  total us       0x!16@XQ", TRUE, &(LAT).sum_usec);		\
 }
 
 /* NEED_TO_DUMP is only for the qualifiers other than "BASIC" and "ALL".
@@ -93,6 +107,7 @@ void dse_dmp_fhead (void)
 	unsigned char		util_buff[MAX_UTIL_LEN], buffer[MAXNUMLEN];
 	int			util_len, rectype, time_len, index, activeque_cnt, freeque_cnt, wipque_cnt, i, j;
 	uint4			jnl_status;
+	gtm_uint64_t		shm_pages;
 	enum jnl_state_codes	jnl_state;
 	gds_file_id		zero_fid;
 	mval			dollarh_mval, zdate_mval;
@@ -100,6 +115,8 @@ void dse_dmp_fhead (void)
 	sgmnt_addrs		*csa;
 	sgmnt_data_ptr_t	csd;
 	node_local_ptr_t	cnl;
+	gvstats_rec_t		gvstats_rec;
+	gvstats_lat_t		gvstats_lat[n_gvstats_lat_types];
 	jnl_private_control	*jpc;
 	jnl_buffer_ptr_t	jb;
 	shmpool_buff_hdr_ptr_t	bptr;
@@ -303,12 +320,23 @@ void dse_dmp_fhead (void)
 				new_line = !new_line;
 			}
 		}
-		/* Additional information regarding kills that are in progress, abandoned and inhibited */
+		/* Additional information regarding kills that are in progress, abandoned, inhibited and deferred */
 		util_out_print(0, TRUE);
 		util_out_print("  Actual kills in progress     !12UL", FALSE, csd->kill_in_prog);
 		util_out_print("  Abandoned Kills       !12UL", TRUE, csd->abandoned_kills);
 		util_out_print("  Process(es) inhibiting KILLs        !5UL", FALSE, cnl->inhibit_kills);
 		util_out_print("  DB is a StatsDB              !AD", TRUE, 5, IS_RDBF_STATSDB(csd) ? " TRUE" : "FALSE");
+		util_out_print("  Deferred free subtrees       !12UL", TRUE, csd->defer_free_cnt);
+		util_out_print("  Allocation cluster blocks    !12UL", FALSE, csd->alloc_cluster);
+		util_out_print("  Scan resistant buffers       !AD", TRUE, 5, csd->scan_resistant ? " TRUE" : "FALSE");
+		util_out_print("  Extend ahead percent         !12UL", TRUE, csd->extend_ahead_pct);
+		shm_pages = cnl->shm_page_size ? DIVIDE_ROUND_UP(cnl->sec_size, cnl->shm_page_size) : 0;
+		util_out_print("  Huge page size (MiB)         !12UL", FALSE, csd->shm_huge_page_mb);
+		util_out_print("  NUMA interleave              !AD", TRUE, 5, csd->shm_numa_interleave ? " TRUE" : "FALSE");
+		util_out_print("  Shared memory size    !19@UQ", FALSE, &cnl->sec_size);
+		util_out_print("  Shared memory page size      !12UL", TRUE, cnl->shm_page_size);
+		util_out_print("  Shared memory pages   !19@UQ", FALSE, &shm_pages);
+		util_out_print("  Shared memory NUMA nodes     !12UL", TRUE, cnl->shm_numa_nodes);
 		util_out_print(0, TRUE);
 		util_out_print("  DB Trigger cycle of ^#t      !12UL", TRUE, csd->db_trigger_cycle);
 		util_out_print(0, TRUE);
@@ -351,9 +379,15 @@ void dse_dmp_fhead (void)
 	if (NEED_TO_DUMP("GVSTATS"))
 	{
                 util_out_print(0, TRUE);
-#		define TAB_GVSTATS_REC(COUNTER,TEXT1,TEXT2)	SHOW_GVSTATS_STAT(cnl, COUNTER, TEXT1, TEXT2)
+		gvstats_rec_cnl_sum(cnl, &gvstats_rec);
+#		define TAB_GVSTATS_REC(COUNTER,TEXT1,TEXT2)	SHOW_GVSTATS_STAT(gvstats_rec, COUNTER, TEXT1, TEXT2)
 #		include "tab_gvstats_rec.h"
 #		undef TAB_GVSTATS_REC
+		/* Latency histograms ($ydb_gvstats_latency), one line per non-empty bucket with its lower bound in microseconds */
+		gvstats_lat_cnl_sum(cnl, gvstats_lat);
+#		define TAB_GVSTATS_LAT(TYPE,TEXT1,TEXT2)	SHOW_GVSTATS_LAT(gvstats_lat[TYPE], TEXT1, TEXT2)
+#		include "tab_gvstats_lat.h"
+#		undef TAB_GVSTATS_LAT
 	}
 	if (NEED_TO_DUMP("TPBLKMOD"))
 	{
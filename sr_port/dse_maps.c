@@ -159,7 +159,7 @@ void dse_maps(void)
 		if (unhandled_stale_timer_pop)
 			process_deferred_stale();
 		free(bml_list);
-		csd->kill_in_prog = csd->abandoned_kills = 0;
+		csd->kill_in_prog = csd->abandoned_kills = csd->defer_free_cnt = 0;
 		return;
 	}
 	if (CLI_PRESENT == cli_present("FREE"))
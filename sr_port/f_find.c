@@ -14,12 +14,17 @@
 #include "opcode.h"
 #include "toktyp.h"
 #include "advancewindow.h"
+#include "op.h"
+#include "gtm_utf8.h"
+
+GBLREF boolean_t        gtm_utf8_mode;
 
 error_def(ERR_COMMA);
 
 int f_find(oprtype *a, opctype op)
 {
 	triple *delimiter, *r, *start;
+	mval tmp_mval;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -46,6 +51,29 @@ int f_find(oprtype *a, opctype op)
 		if (EXPR_FAIL == expr(&(start->operand[0]), MUMPS_INT))
 			return FALSE;
 	}
+	/* If all arguments are literals, run at compile time and return the result */
+	if ((OC_LIT == r->operand[0].oprval.tref->opcode)
+		&& (OC_LIT == delimiter->operand[0].oprval.tref->opcode)
+		&& (OC_ILIT == start->operand[0].oprval.tref->opcode)
+		&& (!gtm_utf8_mode || (valid_utf_string(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v.str)
+			&& valid_utf_string(&delimiter->operand[0].oprval.tref->operand[0].oprval.mlit->v.str))))
+	{
+		if (OC_FNFIND == op)
+		{
+			op_fnfind(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+				&delimiter->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+				start->operand[0].oprval.tref->operand[0].oprval.ilit, &tmp_mval);
+		} else
+		{
+			assert(OC_FNZFIND == op);
+			op_fnzfind(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+				&delimiter->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+				start->operand[0].oprval.tref->operand[0].oprval.ilit, &tmp_mval);
+		}
+		*a = put_lit(&tmp_mval);
+		a->oprval.tref->src = r->src;
+		return TRUE;
+	}
 	ins_triple(r);
 	*a = put_tref(r);
 	return TRUE;
@@ -14,10 +14,15 @@
 #include "opcode.h"
 #include "toktyp.h"
 #include "advancewindow.h"
+#include "op.h"
+#include "gtm_utf8.h"
+
+GBLREF boolean_t        gtm_utf8_mode;
 
 int f_length(oprtype *a, opctype op)
 {
 	triple *r;
+	mval tmp_mval;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -32,6 +37,35 @@ int f_length(oprtype *a, opctype op)
 		if (EXPR_FAIL == expr(&(r->operand[1]), MUMPS_STR))
 			return FALSE;
 	}
+	/* If all arguments are literals, compute the length at compile time */
+	if ((OC_LIT == r->operand[0].oprval.tref->opcode)
+		&& ((NO_REF == r->operand[1].oprclass) || (OC_LIT == r->operand[1].oprval.tref->opcode))
+		&& (!gtm_utf8_mode || (valid_utf_string(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v.str)
+			&& ((NO_REF == r->operand[1].oprclass)
+				|| valid_utf_string(&r->operand[1].oprval.tref->operand[0].oprval.mlit->v.str)))))
+	{
+		switch (r->opcode)
+		{
+			case OC_FNLENGTH:
+				op_fnlength(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+				break;
+			case OC_FNZLENGTH:
+				op_fnzlength(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+				break;
+			case OC_FNPOPULATION:
+				op_fnpopulation(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+					&r->operand[1].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+				break;
+			default:
+				assert(OC_FNZPOPULATION == r->opcode);
+				op_fnzpopulation(&r->operand[0].oprval.tref->operand[0].oprval.mlit->v,
+					&r->operand[1].oprval.tref->operand[0].oprval.mlit->v, &tmp_mval);
+				break;
+		}
+		*a = put_lit(&tmp_mval);
+		a->oprval.tref->src = r->src;
+		return TRUE;
+	}
 	ins_triple(r);
 	*a = put_tref(r);
 	return TRUE;
@@ -90,6 +90,8 @@
 #include "mupipbckup.h"
 #include "dpgbldir.h"
 #include "mmemory.h"
+#include "gtm_malloc.h"	/* for storStats_t */
+#include "gtmlink.h"	/* for linkStats_t */
 #include "have_crit.h"
 #include "alias.h"
 #include "ztimeout_routines.h"
@@ -340,6 +342,7 @@ GBLDEF	u_casemap_t 		gtm_strToTitle_ptr;		/* Function pointer for gtm_strToTitle
 #endif
 GBLDEF	boolean_t		mu_reorg_process;		/* set to TRUE by MUPIP REORG */
 GBLDEF	boolean_t		mu_reorg_in_swap_blk;		/* set to TRUE for the duration of the call to "mu_swap_blk" */
+GBLDEF	uint4			mu_reorg_blks_per_sec;		/* MUPIP REORG -RATE; 0 if blocks are processed as fast as possible */
 GBLDEF	boolean_t		mu_rndwn_process;
 GBLDEF	gv_key			*gv_currkey_next_reorg;
 GBLDEF	gv_namehead		*reorg_gv_target;
@@ -723,6 +726,8 @@ GBLDEF	boolean_t	gvdupsetnoop = TRUE;	/* if TRUE, duplicate SETs do not change G
 						 * incremented and logical SET journal records will be written. By default, this
 						 * behavior is turned ON. GT.M has a way of turning it off with a VIEW command.
 						 */
+GBLDEF	boolean_t	ydb_gvstats_latency;	/* Maintain latency histograms in the database statistics */
+GBLDEF	boolean_t	ydb_kill_defer_free;	/* Leave freeing of subtrees detached by a KILL to MUPIP REORG -FREE_DEFERRED */
 GBLDEF  int4		ydb_fullblockwrites;	/* Do full (not partial) 1. file system block writes, or 2. database block writes */
 GBLDEF	volatile boolean_t	in_wcs_recover;	/* TRUE if in "wcs_recover", used by "bt_put" and "generic_exit_handler" */
 GBLDEF	boolean_t	in_gvcst_incr;		/* set to TRUE by gvcst_incr, set to FALSE by gvcst_put
@@ -734,7 +739,8 @@ GBLDEF	boolean_t	is_dollar_incr;		/* valid only if gvcst_put is in the call-stac
 						 * is a copy of "in_gvcst_incr" just before it got reset to FALSE */
 GBLDEF	int		indir_cache_mem_size;	/* Amount of memory currently in use by indirect cache */
 GBLDEF	hash_table_objcode cache_table;
-GBLDEF  int		cache_hits, cache_fails;
+GBLDEF  int		cache_hits, cache_fails, cache_evicts;
+GBLDEF	cache_entry	cache_lru_queue;	/* Anchor for the indirect cache entries in least recently used order */
 /* The alignment feature is disabled due to some issues in stringpool garbage collection.
  * TODO: When we sort out stringpool issues, change mstr_native_align to TRUE below */
 GBLDEF	boolean_t	mstr_native_align;
@@ -861,6 +867,8 @@ GBLDEF  size_t  totalUsed;                              /* Sum of user allocated
 GBLDEF	size_t	totalRallocGta;				/* Total storage currently (real) mmap alloc'd */
 GBLDEF	size_t  totalAllocGta;                          /* Total mmap allocated (includes allocation overhead but not free space */
 GBLDEF	size_t  totalUsedGta;                           /* Sum of "in-use" portions (totalAllocGta - overhead) */
+GBLDEF	storStats_t	storStats;				/* Storage manager OS interaction counters ($VIEW("STORSTATS")) */
+GBLDEF	linkStats_t	linkStats;				/* Object code section map/read counters ($VIEW("RTNSTATS")) */
 GBLDEF	volatile char		*outOfMemoryMitigation;	/* Cache that we will freed to help cleanup if run out of memory */
 GBLDEF	uint4			outOfMemoryMitigateSize;/* Size of above cache (in Kbytes) */
 GBLDEF	int 			mcavail;
@@ -532,6 +532,19 @@ typedef struct blk_info_struct
 # define DBG_RECORD_CRYPT_RECEIVE(CSD, CSA, CNL, PID, TRANS_INFO)
 #endif
 
+/* Parts of an MM database file updated since its last msync, so that wcs_mm_msync need not msync the whole file. A range
+ * is a run of 2MB (the usual huge page size) pieces of the file counting from block 0.
+ */
+#define	MM_DIRTY_GRANULE_SHIFT	21
+#define	MM_DIRTY_RANGES		64
+#define	MM_DIRTY_ALL		-1	/* mm_dirty_cnt once the ranges ran out; the next msync covers the whole file */
+
+typedef struct
+{
+	uint4		first;
+	uint4		last;
+} mm_dirty_range_t;
+
 /* Mapped space local to each node on the cluster */
 typedef struct node_local_struct
 {
@@ -628,7 +641,7 @@ typedef struct node_local_struct
 	char		statsdb_fname[MAX_FN_LEN + 1];	/* Is empty-string if IS_RDBF_STATSDB(csd) is FALSE.
 							 * Is name of the statsdb corresponding to this basedb otherwise.
 							 */
-	gvstats_rec_t	gvstats_rec;
+	gvstats_rec_t	gvstats_rec;		/* database wide statistics as of shared memory creation, see gvstats_rec.h */
 	trans_num	last_wcsflu_tn;			/* curr_tn when last wcs_flu was done on this database */
 	trans_num	last_wcs_recover_tn;		/* csa->ti->curr_tn of most recent "wcs_recover" */
 	sm_off_t	encrypt_glo_buff_off;	/* offset from unencrypted global buffer to its encrypted counterpart */
@@ -709,6 +722,15 @@ typedef struct node_local_struct
 	volatile gtm_uint64_t	dskspace_next_fire;
 	global_latch_t	lock_crit;		/* mutex for LOCK processing */
 	volatile block_id	tp_hint;
+	volatile block_id	alloc_cluster_next;	/* start of the next cluster to hand out with MUPIP SET -CLUSTER_BLOCKS */
+	volatile uint4	flusher_pid;		/* pid of the MUPIP FLUSHER keeping this region's buffers clean, 0 if none */
+	uint4		shm_page_size;		/* size of the pages backing this shared memory (see MUPIP SET -HUGE_PAGES) */
+	uint4		shm_numa_nodes;		/* # of NUMA nodes its pages are interleaved across, 0 if not interleaved */
+	int4		mm_dirty_cnt;		/* # of mm_dirty[] ranges in use (MM only), or MM_DIRTY_ALL */
+	volatile int4	gvstats_shard_next;	/* gvstats_shard[] slot handed to the next process to open the database */
+	mm_dirty_range_t mm_dirty[MM_DIRTY_RANGES];	/* updated since the last msync, see wcs_mm_dirty */
+	gvstats_rec_t	gvstats_base;		/* database wide statistics as of the last reset, see gvstats_rec.h */
+	gvstats_shard_t	gvstats_shard[GVSTATS_SHARD_CNT] CACHELINE_ALIGNED;	/* per-process-slot database statistics */
 } node_local;
 
 #define	COPY_STATSDB_FNAME_INTO_STATSREG(statsDBreg, statsDBfname, statsDBfname_len)				\
@@ -980,6 +1002,12 @@ MBSTART {															\
 		NUM_CRIT_ENTRY(CSD) = DEFAULT_NUM_CRIT_ENTRY;									\
 } MBEND
 
+/* TRUE if a MUPIP FLUSHER process is keeping the global buffers of the region clean. Foreground processes then leave the
+ * epoch taper and stale buffer flushes to it and only write buffers themselves when they reach the flush trigger or run
+ * out of clean buffers.
+ */
+#define FLUSHER_ACTIVE(CNL)	(0 != (CNL)->flusher_pid)
+
 #define ETGENTLE  2
 #define ETSLOW    8
 #define ETQUICK   16
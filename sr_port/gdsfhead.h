@@ -1689,13 +1689,30 @@ MBSTART {												\
 		(CSA)->gvstats_rec_p->COUNTER = VALUE;							\
 } MBEND
 
-#define	INCR_GVSTATS_COUNTER(CSA, CNL, COUNTER, INCREMENT)						\
+#define	INCR_GVSTATS_COUNTER(CSA, CNL, COUNTER, INCREMENT)							\
+MBSTART {													\
+	if (0 == (RDBF_NOSTATS & (CSA)->reservedDBFlags))							\
+	{													\
+		(CSA)->gvstats_rec_p->COUNTER += INCREMENT;		/* private or shared stats */		\
+		/* database stats */										\
+		(CNL)->gvstats_shard[(CSA)->gvstats_shard].gvstats_rec.COUNTER += INCREMENT;			\
+	}													\
+} MBEND
+
+/* Bracket an operation whose latency goes into the gvstats_lat_t histogram TYPE (see tab_gvstats_lat.h).
+ * START is a gtm_uint64_t local which stays 0 (and so turns GVSTATS_LAT_END into a no-op) unless $ydb_gvstats_latency is set.
+ */
+#define	GVSTATS_LAT_START(START)									\
 MBSTART {												\
-	if (0 == (RDBF_NOSTATS & (CSA)->reservedDBFlags))						\
-	{												\
-		(CSA)->gvstats_rec_p->COUNTER += INCREMENT;		/* private or shared stats */	\
-		(CNL)->gvstats_rec.COUNTER += INCREMENT;		/* database stats */ 		\
-	}												\
+	GBLREF	boolean_t	ydb_gvstats_latency;							\
+													\
+	(START) = ydb_gvstats_latency ? gvstats_lat_now() : 0;						\
+} MBEND
+
+#define	GVSTATS_LAT_END(CSA, TYPE, START)								\
+MBSTART {												\
+	if ((START) && (0 == (RDBF_NOSTATS & (CSA)->reservedDBFlags)))					\
+		gvstats_lat_record(CSA, TYPE, gvstats_lat_now() - (START));				\
 } MBEND
 
 #define	SYNC_RESERVEDDBFLAGS_REG_CSA_CSD(REG, CSA, CSD, CNL)								\
@@ -1868,6 +1885,17 @@ MBSTART {														\
 	}														\
 } MBEND
 
+/* Maximum number of detached index blocks whose subtrees a KILL can leave in the file header for MUPIP REORG -FREE_DEFERRED
+ * to free (see "defer_free_blk" below and gvcst_defer_free_subtree).
+ */
+#define	DEFER_FREE_MAX		128
+
+/* Largest huge page size (in MiB) MUPIP SET -HUGE_PAGES accepts for "shm_huge_page_mb" (x86_64 has 2MiB and 1GiB pages) */
+#define	MAX_SHM_HUGE_PAGE_MB	1024
+
+/* Largest free block percentage below which MUPIP SET -EXTEND_AHEAD can have MUPIP FLUSHER extend the file */
+#define	MAX_EXTEND_AHEAD_PCT	90
+
 /* This is the structure describing a segment. It is used as a database file header (for MM or BG access methods).
  * The overloaded fields for MM and BG are n_bts, bt_buckets. */
 
@@ -2169,7 +2197,32 @@ typedef struct sgmnt_data_struct
 	char		filler_7k[440];
 	/************** YottaDB specific fields *********************/
 	uint4		reorg_sleep_nsec;	/* Time a MUPIP REORG sleeps before starting to process a GDS block */
-	char		filler_8k[1020];
+	int4		defer_free_cnt;		/* Number of valid entries in "defer_free_blk[]". Updated only while holding crit */
+	block_id	defer_free_blk[DEFER_FREE_MAX];	/* Index blocks detached by a committed KILL ($ydb_kill_defer_free)
+							 * whose subtrees (including themselves) are still marked busy and
+							 * are yet to be freed by MUPIP REORG -FREE_DEFERRED.
+							 */
+	uint4		alloc_cluster;		/* MUPIP SET -CLUSTER_BLOCKS. If non-zero, blocks created for a global are
+						 * allocated from runs (clusters) of this many blocks claimed for that
+						 * global (see bm_cluster_hint)
+						 */
+	boolean_t	scan_resistant;		/* MUPIP SET -SCAN_RESISTANT. If TRUE, db_csh_getn keeps blocks that were
+						 * read in only once (as by a scan) from displacing index blocks and blocks
+						 * that are referenced repeatedly.
+						 */
+	uint4		shm_huge_page_mb;	/* MUPIP SET -HUGE_PAGES. If non-zero, the size in MiB of the huge pages to
+						 * back the shared memory (global buffers, journal buffer, lock space) with
+						 * when it is next created.
+						 */
+	boolean_t	shm_numa_interleave;	/* MUPIP SET -NUMA_INTERLEAVE. If TRUE, the pages of the shared memory are
+						 * spread across the NUMA nodes when it is next created.
+						 */
+	uint4		extend_ahead_pct;	/* MUPIP SET -EXTEND_AHEAD. If non-zero, MUPIP FLUSHER extends the file by
+						 * extension_size blocks once fewer than this percentage of the blocks are free
+						 * (see gdsfilext_ahead).
+						 */
+	char		filler_8k[1020 - SIZEOF(int4) - (DEFER_FREE_MAX * SIZEOF(block_id)) - SIZEOF(uint4)
+				- SIZEOF(boolean_t) - SIZEOF(uint4) - SIZEOF(boolean_t) - SIZEOF(uint4)];
 	/********************************************************/
 	/* Master bitmap immediately follows. Tells whether the local bitmaps have any free blocks or not. */
 } sgmnt_data;
@@ -2605,6 +2658,9 @@ typedef struct	sgmnt_addrs_struct
 	gtmcrypt_key_t				encr_key_handle2;
 	enc_info_t				*encr_ptr;	/* Copy of encryption info from the database file header */
 	struct snapshot_context_struct 		*ss_ctx;
+	struct snapshot_read_struct		*ss_read;	/* non-NULL while VIEW "SNAPSHOT" has this process read the region
+								 * as of its own snapshot (see ss_snapshot_read.c)
+								 */
 	union
 	{
 		sgmm_addrs	mm;
@@ -2721,6 +2777,7 @@ typedef struct	sgmnt_addrs_struct
 	int				mlkhash_shmid;	/* Shared memory id of attached lock hash array, or zero if internal.
 							 * Set by GRAB_LOCK_CRIT().
 							 */
+	int4		gvstats_shard;		/* index of the cnl->gvstats_shard[] this process updates, see gvstats_rec.h */
 } sgmnt_addrs;
 
 typedef struct gd_binding_struct
@@ -2919,9 +2976,17 @@ typedef struct	gv_namehead_struct
 	boolean_t	nct_must_be_zero;		/* this gvt is part of a multi-region spanning global and hence
 							 * its "nct" cannot be anything but zero.
 							 */
+	block_id	alloc_next;			/* With MUPIP SET -CLUSTER_BLOCKS, the block following the one last
+							 * allocated for this global (the allocation hint within its cluster).
+							 * 0 if none yet. See bm_cluster_hint.
+							 */
+	int4		filler_8byte_align3;
 	boolean_t	split_cleanup_needed;
 	char		last_split_direction[MAX_BT_DEPTH - 1];	/* maintain last split direction for each level in the GVT */
-	char		filler_8byte_align1[6];
+	unsigned char	fill_factor;			/* VIEW "GBLFILLFACTOR" setting for this global. 0 means the
+							 * process wide VIEW "FILL_FACTOR" applies (see GVT_FILLFACTOR).
+							 */
+	char		filler_8byte_align1[5];
 	block_id	last_split_blk_num[MAX_BT_DEPTH - 1];
 #	ifdef GTM_TRIGGER
 	struct gvt_trigger_struct *gvt_trigger;		/* pointer to trigger info for this global
@@ -2937,6 +3002,11 @@ typedef struct	gv_namehead_struct
 	gv_key		clue;				/* Clue key, must be last in namehead struct because of hung buffer. */
 } gv_namehead;
 
+/* Fill factor (percentage of a block that updates fill before a block split) to use for the global "GVT".
+ * The caller needs a GBLREF of gv_fillfactor.
+ */
+#define	GVT_FILLFACTOR(GVT)	((GVT)->fill_factor ? (int)(GVT)->fill_factor : gv_fillfactor)
+
 /* Below structure is allocated for every global name that spans across multiple regions in each global directory */
 typedef struct gvnh_spanreg_struct
 {
@@ -5469,6 +5539,9 @@ gd_addr	*create_dummy_gbldir(void);
 void	gvstats_rec_csd2cnl(sgmnt_addrs *csa);
 void	gvstats_rec_cnl2csd(sgmnt_addrs *csa);
 void	gvstats_rec_upgrade(sgmnt_addrs *csa);
+void	gvstats_rec_cnl_sum(node_local_ptr_t cnl, gvstats_rec_t *sum);
+void	gvstats_lat_cnl_sum(node_local_ptr_t cnl, gvstats_lat_t *sum);
+void	gvstats_lat_record(sgmnt_addrs *csa, enum gvstats_lat_type type, gtm_uint64_t nsec);
 
 void act_in_gvt(gv_namehead *gvt);
 
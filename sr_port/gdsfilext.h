@@ -15,6 +15,7 @@
 
 #ifdef UNIX
 uint4 gdsfilext(uint4 blocks, uint4 filesize, boolean_t trans_in_prog);
+uint4 gdsfilext_ahead(void);
 # define GDSFILEXT(BLOCKS, FILESIZE, TRANS_IN_PROG)	gdsfilext(BLOCKS, FILESIZE, TRANS_IN_PROG)
 #else
 uint4 gdsfilext(uint4 blocks, uint4 filesize);
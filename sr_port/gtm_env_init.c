@@ -73,6 +73,8 @@ GBLREF	uint4		ydbDebugLevel; 		/* Debug level (0 = using default sm module so wi
 						   a DEBUG build, even level 0 implies basic debugging) */
 GBLREF	boolean_t	ydbSystemMalloc;	/* Use the system's malloc() instead of our own */
 GBLREF	int4		ydb_fullblockwrites;	/* Do full (not partial) database block writes */
+GBLREF	boolean_t	ydb_gvstats_latency;	/* Maintain latency histograms in the database statistics */
+GBLREF	boolean_t	ydb_kill_defer_free;	/* Leave freeing of subtrees detached by a KILL to MUPIP REORG -FREE_DEFERRED */
 GBLREF	boolean_t	certify_all_blocks;
 GBLREF	uint4		ydb_blkupgrade_flag;	/* controls whether dynamic block upgrade is attempted or not */
 GBLREF	boolean_t	ydb_dbfilext_syslog_disable;	/* control whether db file extension message is logged or not */
@@ -245,6 +247,14 @@ void	gtm_env_init(void)
 				break;
 			}
 		}
+		/* Latency histograms in the database statistics */
+		ydb_gvstats_latency = ydb_logical_truth_value(YDBENVINDX_GVSTATS_LATENCY, FALSE, &is_defined);
+		if (!is_defined)
+			ydb_gvstats_latency = FALSE;
+		/* Deferred freeing of subtrees detached by a KILL */
+		ydb_kill_defer_free = ydb_logical_truth_value(YDBENVINDX_KILL_DEFER_FREE, FALSE, &is_defined);
+		if (!is_defined)
+			ydb_kill_defer_free = FALSE;
 		/* GDS Block certification */
 		ret = ydb_logical_truth_value(YDBENVINDX_GDSCERT, FALSE, &is_defined);
 		if (is_defined)
@@ -319,6 +329,10 @@ void	gtm_env_init(void)
 			if ((ERANGE != errno) && (TPNOTACID_MAX_TIME >= time))
 				(TREF(tpnotacidtime)).m[1] = time * MILLISECS_IN_SEC;
 		}	/* gtm_startup completes initialization of the tpnotacidtime mval */
+		/* See if $ydb_tpnodeconflict is set */
+		TREF(tp_nodeconflict) = ydb_logical_truth_value(YDBENVINDX_TPNODECONFLICT, FALSE, &is_defined);
+		if (!is_defined)
+			TREF(tp_nodeconflict) = FALSE;
 		/* Initialize $ydb_tprestart_log_first */
 		TREF(tprestart_syslog_first) = ydb_trans_numeric(YDBENVINDX_TPRESTART_LOG_FIRST, &is_defined,
 												IGNORE_ERRORS_TRUE, NULL);
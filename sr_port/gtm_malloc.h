@@ -63,6 +63,20 @@ typedef struct storElemStruct
 #	endif
 } storElem;
 
+/* Counters describing how the storage manager obtains storage from, and gives it back to, the OS. These are maintained
+ * in both pro and debug flavors of the storage manager (unlike the DEBUG-only instrumentation in gtm_malloc_src.h) so
+ * they can be reported through $VIEW("STORSTATS") in the field.
+ */
+typedef struct
+{
+	gtm_uint64_t	extAlloc;			/* Extents (real) malloc'd to feed the buddy queues */
+	gtm_uint64_t	extFree;			/* Extents released with a (real) free */
+	gtm_uint64_t	bigAlloc;			/* Requests larger than MAXTWO satisfied by a (real) malloc */
+	gtm_uint64_t	bigFree;			/* Requests larger than MAXTWO released with a (real) free */
+	gtm_uint64_t	trimCnt;			/* Times freed storage was trimmed back to the OS */
+	gtm_uint64_t	trimPend;			/* Bytes (real) freed since the last trim */
+} storStats_t;
+
 size_t gtm_bestfitsize(size_t);
 void verifyFreeStorage(void);
 void verifyAllocatedStorage(void);
@@ -144,6 +144,31 @@
 	DEBUG_ONLY(memset(addr, 0, size));									\
 }
 #  define FREE(size, addr) free(addr);
+/* glibc's free() only hands storage back to the OS when it sits at the top of the heap (or was mmap'd), so a long running
+ * process that once peaked keeps that RSS even after the extents and large blocks are released here. Once enough storage
+ * has been (real) freed since the last time, call malloc_trim() which madvise()s away the free pages in the middle of the
+ * heap and its arenas too. The threshold keeps the cost (a walk of the free chunks) well amortized.
+ */
+#define STOR_TRIM_THRESHOLD (8 * 1024 * 1024)
+#ifdef __GLIBC__
+/* #GTM_THREAD_SAFE : The below macro (TRIM_FREED_STORAGE) is thread-safe because caller ensures serialization with locks */
+#  define TRIM_FREED_STORAGE(FORCE)										\
+{														\
+	intrpt_state_t  prev_intrpt_state;									\
+														\
+	assert(IS_PTHREAD_LOCKED_AND_HOLDER);									\
+	if ((FORCE) ? (0 < storStats.trimPend) : (STOR_TRIM_THRESHOLD <= storStats.trimPend))			\
+	{													\
+		DEFER_INTERRUPTS(INTRPT_IN_FUNC_WITH_MALLOC, prev_intrpt_state);				\
+		malloc_trim(0);											\
+		ENABLE_INTERRUPTS(INTRPT_IN_FUNC_WITH_MALLOC, prev_intrpt_state);				\
+		storStats.trimPend = 0;										\
+		storStats.trimCnt++;										\
+	}													\
+}
+#else
+#  define TRIM_FREED_STORAGE(FORCE)
+#endif
 #define MAXBACKFILL (16 * 1024)			/* Maximum backfill of large structures */
 #define MAXTWO 2048				/* Maximum size we allocate from queues */
 /* How many "MAXTWO" elements to allocate at one time. This minimizes the waste since our subblocks must
@@ -336,6 +361,7 @@ GBLREF	ch_ret_type	(*stpgc_ch)();			/* Function pointer to stp_gcol_ch */
 /* This var allows us to call ourselves but still have callerid info */
 GBLREF	unsigned char	*smCallerId;			/* Caller of top level malloc/free */
 GBLREF	volatile int4	fast_lock_count;		/* Stop stale/epoch processing while we have our parts exposed */
+GBLREF	storStats_t	storStats;			/* Storage manager OS interaction counters */
 OS_PAGE_SIZE_DECLARE
 #define SIZETABLEDIM MAXTWO/MINTWO
 STATICD int size2Index[SIZETABLEDIM];
@@ -596,6 +622,7 @@ storElem *findStorElem(int sizeIndex)	/* Note renamed to findStorElem_dbg when i
 		 * on a power of two boundary necessary for buddy alignment.
 		 */
 		MALLOC(EXTENT_SIZE, uStorAlloc);
+		storStats.extAlloc++;
 		uStor2 = (storElem *)uStorAlloc;
 		/* Make addr "MAXTWO" byte aligned */
 		uStor = (storElem *)(((unsigned long)(uStor2) + MAXTWO - 1) & (unsigned long) -MAXTWO);
@@ -746,6 +773,7 @@ void *gtm_malloc(size_t size)	/* Note renamed to gtm_malloc_dbg when included in
 				} else
 				{	/* Use regular malloc to obtain the piece */
 					MALLOC(tSize, uStor);
+					storStats.bigAlloc++;
 					totalRmalloc += tSize;
 					SET_MAX(rmallocMax, totalRmalloc);
 					uStor->queueIndex = REAL_MALLOC;
@@ -993,6 +1021,9 @@ void gtm_free(void *addr)	/* Note renamed to gtm_free_dbg when included in gtm_m
 						totalRmalloc -= EXTENT_SIZE;
 						--curExtents;
 						assert(curExtents);
+						storStats.extFree++;
+						storStats.trimPend += EXTENT_SIZE;
+						TRIM_FREED_STORAGE(FALSE);
 					}
 				}
 			} else
@@ -1008,6 +1039,9 @@ void gtm_free(void *addr)	/* Note renamed to gtm_free_dbg when included in gtm_m
 				FREE(allocSize, uStor);
 				totalRmalloc -= allocSize;
 				totalAlloc -= allocSize;
+				storStats.bigFree++;
+				storStats.trimPend += allocSize;
+				TRIM_FREED_STORAGE(FALSE);
 			}
 		} else
 			saveSize = 0; /* 4SCA: Using the null struct so this isn't important */
@@ -1062,6 +1096,7 @@ void release_unused_storage(void)	/* Note renamed to release_unused_storage_dbg
 	   function pointer. */
 	if (NULL != cache_table_relobjs)
 		(*cache_table_relobjs)();	/* Release object code in indirect cache */
+	TRIM_FREED_STORAGE(TRUE);		/* Give whatever the above released back to the OS */
 }
 
 /* Raise ERR_MEMORY. Separate routine since is called from hashtable logic in place of the
@@ -40,6 +40,7 @@ THREADGBLDEF(grabbing_crit, 			gd_region *)			/* Region currently grabbing crit
 /* Compiler */
 THREADGBLDEF(blkmod_fail_level,			int4)				/* TP trace reporting element */
 THREADGBLDEF(blkmod_fail_type,			int4)				/* TP trace reporting element */
+THREADGBLDEF(cmd_xfer_uncond,			boolean_t)			/* flag last command always transfers control */
 THREADGBLDEF(block_level,			int4)				/* used to check embedded subroutine levels */
 THREADGBLDEF(boolchain,				triple)				/* anchor for chain used by bx_boolop  */
 THREADGBLDEF(boolchain_ptr,			triple *)			/* pointer to anchor for chain used by bx_boolop  */
@@ -184,6 +185,8 @@ THREADGBLDEF(redo_rootsrch_ctxt,		redo_root_search_context)	/* context to be sav
 										 * gvcst_redo_root_search */
 THREADGBLDEF(semwait2long,			volatile boolean_t)		/* Waited too long for a semaphore */
 THREADGBLDEF(skip_file_corrupt_check,		boolean_t)			/* skip file_corrupt check in grab_crit */
+THREADGBLDEF(tp_nodeconflict,			boolean_t)			/* TRUE if blind SETs in TP are recomputed, not
+											 * restarted, on a leaf block conflict */
 THREADGBLDEF(tpnotacidtime,			mval)				/* limit for long non-ACID ops in transactions */
 THREADGBLDEF(tp_restart_count,			uint4)				/* tp_restart counter */
 THREADGBLDEF(tp_restart_dont_counts,		int4)				/* tp_restart count adjustment; NOTE: DEBUG only */
@@ -333,6 +336,7 @@ THREADGBLDEF(pipefifo_interrupt,		int)				/* count of number of times a pipe or
 										 * interrupted */
 THREADGBLDEF(prof_fp,				mprof_stack_frame *)		/* Stack frame that mprof currently operates on */
 THREADGBLDEF(relink_allowed,			int)				/* Non-zero if recursive relink permitted */
+THREADGBLDEF(link_mmap,			boolean_t)			/* TRUE if process private objects are mmap()ed */
 #ifdef AUTORELINK_SUPPORTED
 THREADGBLDEF(save_zhist,			zro_hist *)			/* Temp storage for zro_hist blk so condition hndler
 										 * can get a hold of it if necessary to free it */
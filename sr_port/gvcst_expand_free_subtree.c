@@ -13,6 +13,7 @@
 #include "mdef.h"
 
 #include "gtm_string.h"
+#include "gtm_stdlib.h"
 
 #include "cdb_sc.h"		/* atleast for cdb_sc_* codes */
 #include "copy.h"		/* atleast for the GET_USHORT macros */
@@ -186,3 +187,76 @@ void	gvcst_expand_free_subtree(kill_set *ks_head)
 		bml_save_dollar_tlevel = 0;
 	}
 }
+
+/* Called (with kill_in_prog still incremented) after a non-TP KILL commits if $ydb_kill_defer_free is set. Rather than reading
+ * every index block of the subtrees the KILL detached and freeing all the blocks under them before the KILL returns, moves the
+ * index block entries of the kill set to csd->defer_free_blk[] for MUPIP REORG -FREE_DEFERRED to free later. Those blocks and
+ * everything under them are unreachable since the commit and stay marked busy until then. The level 0 entries are left in the
+ * kill set for the caller to free as usual. Nothing is moved if the list does not have room for all the index block entries or
+ * if an online rollback happened after the commit (gvcst_expand_free_subtree deals with that case).
+ */
+void	gvcst_defer_free_subtree(kill_set *ks_head)
+{
+	blk_ident		*ksb, *ksb_out;
+	boolean_t		was_crit;
+	int			cnt, idx_cnt;
+	kill_set		*ks, *ks_out, *next_ks;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+
+	assert(!dollar_tlevel);
+	csa = cs_addrs;
+	csd = cs_data;
+	if (IS_RDBF_STATSDB(csd))
+		return;
+	for (idx_cnt = 0, ks = ks_head; NULL != ks; ks = ks->next_kill_set)
+	{
+		for (cnt = 0; cnt < ks->used; ++cnt)
+			if (0 != ks->blk[cnt].level)
+				idx_cnt++;
+	}
+	if (0 == idx_cnt)
+		return;
+	if (!(was_crit = csa->now_crit))
+		grab_crit(gv_cur_region);
+	if ((csa->onln_rlbk_cycle != csa->nl->onln_rlbk_cycle) || ((DEFER_FREE_MAX - csd->defer_free_cnt) < idx_cnt))
+	{
+		if (!was_crit)
+			rel_crit(gv_cur_region);
+		return;
+	}
+	/* Squeeze the level 0 entries to the front of the kill set chain (the output never gets ahead of the input) */
+	ks_out = ks_head;
+	ksb_out = &ks_out->blk[0];
+	for (ks = ks_head; NULL != ks; ks = ks->next_kill_set)
+	{
+		for (cnt = 0; cnt < ks->used; ++cnt)
+		{
+			ksb = &ks->blk[cnt];
+			if (0 != ksb->level)
+			{
+				assert(!ksb->flag && (ksb->block < csa->ti->total_blks));
+				csd->defer_free_blk[csd->defer_free_cnt++] = ksb->block;
+				continue;
+			}
+			if (ksb_out == &ks_out->blk[BLKS_IN_KILL_SET])
+			{
+				ks_out->used = BLKS_IN_KILL_SET;
+				ks_out = ks_out->next_kill_set;
+				ksb_out = &ks_out->blk[0];
+			}
+			*ksb_out++ = *ksb;
+		}
+	}
+	assert(DEFER_FREE_MAX >= csd->defer_free_cnt);
+	GVSTATS_SET_CSA_STATISTIC(csa, n_kill_defer_pend, csd->defer_free_cnt);
+	if (!was_crit)
+		rel_crit(gv_cur_region);
+	ks_out->used = (int4)(ksb_out - &ks_out->blk[0]);
+	for (ks = ks_out->next_kill_set; NULL != ks; ks = next_ks)
+	{
+		next_ks = ks->next_kill_set;
+		free(ks);
+	}
+	ks_out->next_kill_set = NULL;
+}
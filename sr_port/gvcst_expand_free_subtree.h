@@ -13,5 +13,6 @@
 #define GVCST_EXPAND_FREE_SUBTREE_INCLUDED
 
 void gvcst_expand_free_subtree(kill_set *ks_head);
+void gvcst_defer_free_subtree(kill_set *ks_head);
 
 #endif /* GVCST_EXPAND_FREE_SUBTREE_INCLUDED */
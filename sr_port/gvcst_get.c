@@ -76,12 +76,15 @@ boolean_t gvcst_get(mval *v)
 	sm_uc_ptr_t	sn_ptr;
 	int		debug_len;
 	int		save_dollar_tlevel;
+	gtm_uint64_t	lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
+	GVSTATS_LAT_START(lat_start);
 	gotit = gvcst_get2(v, NULL);
 	INCR_GVSTATS_COUNTER(cs_addrs, cs_addrs->nl, n_get, (gtm_uint64_t) 1);
+	GVSTATS_LAT_END(cs_addrs, lat_get, lat_start);
 	WBTEST_ONLY(WBTEST_QUERY_HANG,
 		LONG_SLEEP(2);
 	);
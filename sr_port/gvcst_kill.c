@@ -115,9 +115,11 @@ GBLREF	jnl_gbls_t		jgbl;
 GBLREF	boolean_t		donot_INVOKE_MUMTSTART;
 #endif
 GBLREF	boolean_t 		span_nodes_disallowed;
+GBLREF	boolean_t		ydb_kill_defer_free;
 
 error_def(ERR_TPRETRY);
 error_def(ERR_GVKILLFAIL);
+error_def(ERR_SNAPSHOTNOTALLOWED);
 
 #ifdef GTM_TRIGGER
 LITREF	mval	literal_null;
@@ -140,13 +142,19 @@ void	gvcst_kill(boolean_t do_subtree)
 	boolean_t	est_first_pass;
 	int		oldend;
 	int		save_dollar_tlevel;
+	gtm_uint64_t	lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
+	if (NULL != cs_addrs->ss_read)	/* VIEW "SNAPSHOT" reads a past state of the region, which cannot be updated */
+		rts_error_csa(CSA_ARG(cs_addrs) VARLSTCNT(6) ERR_SNAPSHOTNOTALLOWED, 4, LEN_AND_LIT("Update"),
+			REG_LEN_STR(gv_cur_region));
 	DEBUG_ONLY(save_dollar_tlevel = dollar_tlevel);
+	GVSTATS_LAT_START(lat_start);
 	if (do_subtree)
 	{	/* If we're killing the whole subtree, that includes any spanning nodes. No need to do anything special */
 		gvcst_kill2(TRUE, NULL, FALSE);
+		GVSTATS_LAT_END(cs_addrs, lat_kill, lat_start);
 		assert(save_dollar_tlevel == dollar_tlevel);
 		return;
 	} else
@@ -155,7 +163,10 @@ void	gvcst_kill(boolean_t do_subtree)
 		gvcst_kill2(FALSE, &spanstat, FALSE);
 		assert(save_dollar_tlevel == dollar_tlevel);
 		if (!spanstat)
+		{
+			GVSTATS_LAT_END(cs_addrs, lat_kill, lat_start);
 			return;
+		}
 	}
 	RTS_ERROR_IF_SN_DISALLOWED;
 #	ifdef DEBUG
@@ -849,7 +860,10 @@ research:
 				 */
 				assert(!csd->dsid);
 				ENABLE_WBTEST_ABANDONEDKILL;
-				gvcst_expand_free_subtree(&kill_set_head);
+				if (ydb_kill_defer_free)
+					gvcst_defer_free_subtree(&kill_set_head);
+				if (0 < kill_set_head.used)
+					gvcst_expand_free_subtree(&kill_set_head);
 				assert(csd == cs_data); /* To ensure they are the same even if MM extensions happened in between */
 				DECR_KIP(csd, csa, kip_csa);
 			}
@@ -152,6 +152,7 @@ error_def(ERR_GVPUTFAIL);
 error_def(ERR_MAXBTLEVEL);
 error_def(ERR_REC2BIG);
 error_def(ERR_RSVDBYTE2HIGH);
+error_def(ERR_SNAPSHOTNOTALLOWED);
 error_def(ERR_TEXT);
 error_def(ERR_TPRETRY);
 error_def(ERR_UNIMPLOP);
@@ -282,9 +283,13 @@ void	gvcst_put(mval *val)
 	boolean_t			save_in_gvcst_incr; /* gvcst_put2 sets this FALSE, so save it in case we need to back out */
 	span_parms			parms;
 	unsigned char			fp_flags;
+	gtm_uint64_t			lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
+	if (NULL != cs_addrs->ss_read)	/* VIEW "SNAPSHOT" reads a past state of the region, which cannot be updated */
+		rts_error_csa(CSA_ARG(cs_addrs) VARLSTCNT(6) ERR_SNAPSHOTNOTALLOWED, 4, LEN_AND_LIT("Update"),
+			REG_LEN_STR(gv_cur_region));
 	parms.span_status = FALSE;
 	parms.blk_reserved_bytes = cs_data->reserved_bytes; /* Only want to read once for consistency */
 	parms.enable_trigger_read_and_fire = TRUE;
@@ -295,10 +300,12 @@ void	gvcst_put(mval *val)
 	fits = RECORD_FITS_IN_A_BLOCK(val, gv_currkey, cs_data->blk_size, parms.blk_reserved_bytes);
 	save_in_gvcst_incr = in_gvcst_incr;
 	if (fits)
-	{
+	{	/* Only this, the common non-spanning case, feeds the SET latency histogram */
+		GVSTATS_LAT_START(lat_start);
 		gvcst_put2(val, &parms);
 		if (!parms.span_status)
 		{
+			GVSTATS_LAT_END(cs_addrs, lat_set, lat_start);
 			assert(save_dollar_tlevel == dollar_tlevel);
 			return; /* We've successfully set a normal non-spanning global. */
 		}
@@ -580,7 +587,7 @@ void	gvcst_put2(mval *val, span_parms *parms)
 	JNLPOOL_INIT_IF_NEEDED(csa, csd, cnl, SCNDDBNOUPD_CHECK_TRUE);
 	blk_size = csd->blk_size;
 	blk_reserved_bytes = parms->blk_reserved_bytes;
-	blk_fill_size = (blk_size * gv_fillfactor) / 100 - blk_reserved_bytes;
+	blk_fill_size = (blk_size * GVT_FILLFACTOR(gv_target)) / 100 - blk_reserved_bytes;
 	lcl_span_status = parms->span_status;
 	if (lcl_span_status)
 	{
@@ -1193,7 +1200,13 @@ tn_restart:
 				&& !memcmp(value.addr, (sm_uc_ptr_t)rp + new_rec_size - value.len, value.len))
 			{
 				duplicate_set = TRUE;
-				if (gvdupsetnoop)
+				/* With $ydb_tpnodeconflict, a leaf block with a recompute list is not validated at commit. A duplicate
+				 * SET that skipped the update would then not be in the recompute list either and would be lost if the
+				 * node changed concurrently, so such a SET has to go through the recompute path like any other.
+				 */
+				if (gvdupsetnoop && !(dollar_tlevel && TREF(tp_nodeconflict) && !gv_target->noisolation
+						&& (NULL != bh->first_tp_srch_status) && (NULL != bh->first_tp_srch_status->cse)
+						&& (NULL != bh->first_tp_srch_status->cse->recompute_list_head)))
 				{	/* We do not want to touch the DB Blocks in case of a duplicate set unless the
 					 * dupsetnoop optimization is disabled. Since it is enabled, let us break right away.
 					 */
@@ -1449,13 +1462,23 @@ tn_restart:
 				 *	4) The cw_set_element hasn't encountered a block-split or a kill
 				 *	5) We don't need an extra_block_split
 				 *
+				 * With $ydb_tpnodeconflict set, 3) is also satisfied for a global with NOISOLATION turned OFF as long
+				 *	as the leaf block has only seen blind SETs in this transaction i.e. it was not referenced before
+				 *	its first SET here (bh->first_tp_srch_status is NULL) and no GET/ORDER/KILL etc. referenced it
+				 *	since (tp_hist clears the recompute list in that case). $INCREMENT and globals with triggers
+				 *	depend on the prior value and so are excluded. All other blocks read by the transaction stay in
+				 *	its history and are validated as usual so isolation is not weakened.
+				 *
 				 * We can also add an optimization that only cse's of mode gds_t_write need to have such updations,
 				 *	but because of the belief that for a nonisolated variable, we will very rarely encounter a
 				 *	situation where a created block (in TP) will have some new keys added to it, and that adding
 				 *	the check slows down the normal code, we don't do that check here.
 				 * -------------------------------------------------------------------------------------------------
 				 */
-				if (cse && gv_target->noisolation && !cse->write_type && !need_extra_block_split)
+				if (cse && !cse->write_type && !need_extra_block_split
+					&& (gv_target->noisolation
+						|| (TREF(tp_nodeconflict) && !is_dollar_incr GTMTRIG_ONLY(&& (NULL == gvt_trigger))
+							&& ((NULL != cse->recompute_list_head) || (NULL == bh->first_tp_srch_status)))))
 				{
 					assert(dollar_tlevel);
 					if ((NULL == cse->recompute_list_tail)
@@ -128,7 +128,8 @@ enum cdb_sc 	gvcst_search(gv_key *pKey,		/* Key to search for */
 	 * for the second invocation. In this case, the clue is guaranteed to be uptodate since it was set just now
 	 * as part of the first invocation. So no need to do anything about clue in final retry for Non-TP.
 	 */
-	if ((0 != pTarg->clue.end) && ((CDB_STAGNATE > t_tries) || !dollar_tlevel || (pTarg->read_local_tn == local_tn)))
+	if ((0 != pTarg->clue.end) && ((CDB_STAGNATE > t_tries) || !dollar_tlevel || (pTarg->read_local_tn == local_tn))
+		&& (NULL == cs_addrs->ss_read))	/* VIEW "SNAPSHOT" buffers of a clue do not outlive its transaction */
 	{	/* Have non-zero clue. Check if it is usable for the current search key. If so validate clue then and use it. */
 		/* In t_end, we skipped validating the clue in case of reorg due to the assumption that reorg never uses the clue
 		 * i.e. it nullifies the clue before calling gvcst_search. However, it doesn't reset the clue for directory tree
@@ -333,7 +334,11 @@ enum cdb_sc 	gvcst_search(gv_key *pKey,		/* Key to search for */
 							break;
 						}
 					}
-					cr->refer = TRUE;
+					/* With MUPIP SET -SCAN_RESISTANT, a data block reused through the clue (as by a $ORDER
+					 * loop walking it) is not a new reference and so does not take it off probation.
+					 */
+					if (srch_status->level || !cs_data->scan_resistant)
+						cr->refer = TRUE;
 				}
 			}
 		}
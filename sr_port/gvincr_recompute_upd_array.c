@@ -85,7 +85,7 @@ enum cdb_sc	gvincr_recompute_upd_array(srch_blk_status *bh, struct cw_set_elemen
 	assert(csa->now_crit);
 	assert(!cse->level && (gds_t_write == cse->mode) && (NULL == cse->new_buff) && (GDS_WRITE_PLAIN == cse->write_type));
 	blk_size = cs_data->blk_size;	/* "blk_size" is also used by the BLK_FINI macro below */
-	blk_fill_size = (blk_size * gv_fillfactor) / 100 - cs_data->reserved_bytes;
+	blk_fill_size = (blk_size * GVT_FILLFACTOR(bh->blk_target)) / 100 - cs_data->reserved_bytes;
 	/* clues for gv_target involved in recomputation need not be nullified since only the value changes (not the key) */
 	assert(CR_NOTVALID != (sm_long_t)cr);
 	if (NULL == cr || CR_NOTVALID == (sm_long_t)cr || (0 <= cr->read_in_progress))
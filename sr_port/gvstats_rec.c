@@ -12,6 +12,7 @@
 #include "mdef.h"
 
 #include "gtm_string.h"
+#include "gtm_time.h"
 
 #include "gdsroot.h"
 #include "gtm_facility.h"
@@ -22,12 +23,110 @@
 
 void	gvstats_rec_csd2cnl(sgmnt_addrs *csa)
 {
-	memcpy(&csa->nl->gvstats_rec, &csa->hdr->gvstats_rec, SIZEOF(gvstats_rec_t));
+	/* node_local is at the start of the (page aligned) database shared memory so shards that start on a cache line
+	 * boundary of node_local never share a cache line with each other or with the fields around them.
+	 */
+	assert(0 == (OFFSETOF(node_local, gvstats_shard[0]) % CACHELINE_SIZE));
+	assert(0 == (SIZEOF(gvstats_shard_t) % CACHELINE_SIZE));
+	memcpy(&csa->nl->gvstats_base, &csa->hdr->gvstats_rec, SIZEOF(gvstats_rec_t));
+	/* The totals are now all in cnl->gvstats_base so start the shards afresh */
+	memset(csa->nl->gvstats_shard, 0, SIZEOF(csa->nl->gvstats_shard));
+	csa->nl->gvstats_rec = csa->nl->gvstats_base;
 }
 
 void	gvstats_rec_cnl2csd(sgmnt_addrs *csa)
 {
-	memcpy(&csa->hdr->gvstats_rec, &csa->nl->gvstats_rec, SIZEOF(gvstats_rec_t));
+	gvstats_rec_cnl_sum(csa->nl, &csa->hdr->gvstats_rec);
+}
+
+/* Returns the database wide statistics: the totals as of the last reset plus what every shard accumulated since */
+void	gvstats_rec_cnl_sum(node_local_ptr_t cnl, gvstats_rec_t *sum)
+{
+	gvstats_rec_t	*shard;
+	int		index;
+
+	*sum = cnl->gvstats_base;
+	for (index = 0; index < GVSTATS_SHARD_CNT; index++)
+	{
+		shard = &cnl->gvstats_shard[index].gvstats_rec;
+#		define TAB_GVSTATS_REC(COUNTER,TEXT1,TEXT2)	sum->COUNTER += shard->COUNTER;
+#		include "tab_gvstats_rec.h"
+#		undef TAB_GVSTATS_REC
+	}
+}
+
+/* Returns the latency histograms of all shards added up. "sum" is an array of n_gvstats_lat_types histograms. */
+void	gvstats_lat_cnl_sum(node_local_ptr_t cnl, gvstats_lat_t *sum)
+{
+	gvstats_lat_t	*lat;
+	int		index, type, bucket;
+
+	memset(sum, 0, n_gvstats_lat_types * SIZEOF(gvstats_lat_t));
+	for (index = 0; index < GVSTATS_SHARD_CNT; index++)
+	{
+		for (type = 0; type < n_gvstats_lat_types; type++)
+		{
+			lat = &cnl->gvstats_shard[index].lat[type];
+			sum[type].sum_usec += lat->sum_usec;
+			for (bucket = 0; bucket < GVSTATS_LAT_BUCKETS; bucket++)
+				sum[type].bucket[bucket] += lat->bucket[bucket];
+		}
+	}
+}
+
+gtm_uint64_t	gvstats_lat_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((gtm_uint64_t)ts.tv_sec * NANOSECS_IN_SEC) + ts.tv_nsec;
+}
+
+gtm_uint64_t	gvstats_lat_count(gvstats_lat_t *lat)
+{
+	gtm_uint64_t	count;
+	int		bucket;
+
+	for (count = 0, bucket = 0; bucket < GVSTATS_LAT_BUCKETS; bucket++)
+		count += lat->bucket[bucket];
+	return count;
+}
+
+/* Returns the latency (in microseconds) that "permille" thousandths of the "count" operations in "lat" did not exceed.
+ * The histogram only has power of 2 resolution so this is the upper bound of the bucket the percentile falls in.
+ */
+gtm_uint64_t	gvstats_lat_percentile(gvstats_lat_t *lat, gtm_uint64_t count, int permille)
+{
+	gtm_uint64_t	rank, seen;
+	int		bucket;
+
+	assert((0 < permille) && (1000 >= permille));
+	if (0 == count)
+		return 0;
+	rank = DIVIDE_ROUND_UP(count * permille, 1000);
+	for (seen = 0, bucket = 0; bucket < (GVSTATS_LAT_BUCKETS - 1); bucket++)
+	{
+		seen += lat->bucket[bucket];
+		if (seen >= rank)
+			break;
+	}
+	return (gtm_uint64_t)1 << bucket;
+}
+
+void	gvstats_lat_record(sgmnt_addrs *csa, enum gvstats_lat_type type, gtm_uint64_t nsec)
+{
+	gvstats_lat_t	*lat;
+	gtm_uint64_t	usec;
+	int		bucket;
+
+	assert((0 <= type) && (n_gvstats_lat_types > type));
+	usec = nsec / NANOSECS_IN_USEC;
+	bucket = ceil_log2_64bit(usec + 1);	/* 0 for 0, N for [2**(N-1), 2**N) */
+	if (GVSTATS_LAT_BUCKETS <= bucket)
+		bucket = GVSTATS_LAT_BUCKETS - 1;
+	lat = &csa->nl->gvstats_shard[csa->gvstats_shard].lat[type];
+	lat->sum_usec += usec;
+	lat->bucket[bucket]++;
 }
 
 void	gvstats_rec_upgrade(sgmnt_addrs *csa)
@@ -39,34 +138,34 @@ void	gvstats_rec_upgrade(sgmnt_addrs *csa)
 	csd = csa->hdr;
 	cnl = csa->nl;
 	/* csd still contains gvstats info in old place. Copy over to new location */
-	cnl->gvstats_rec.n_nontp_retries_0 = csd->filler_n_retries[0];
-	cnl->gvstats_rec.n_nontp_retries_1 = csd->filler_n_retries[1];
-	cnl->gvstats_rec.n_nontp_retries_2 = csd->filler_n_retries[2];
-	cnl->gvstats_rec.n_nontp_retries_3 = csd->filler_n_retries[3];
-	cnl->gvstats_rec.n_set             = csd->filler_n_puts;
-	cnl->gvstats_rec.n_kill            = csd->filler_n_kills;
-	cnl->gvstats_rec.n_query           = csd->filler_n_queries;
-	cnl->gvstats_rec.n_get             = csd->filler_n_gets;
-	cnl->gvstats_rec.n_order           = csd->filler_n_order;
-	cnl->gvstats_rec.n_zprev           = csd->filler_n_zprevs;
-	cnl->gvstats_rec.n_data            = csd->filler_n_data;
+	cnl->gvstats_base.n_nontp_retries_0 = csd->filler_n_retries[0];
+	cnl->gvstats_base.n_nontp_retries_1 = csd->filler_n_retries[1];
+	cnl->gvstats_base.n_nontp_retries_2 = csd->filler_n_retries[2];
+	cnl->gvstats_base.n_nontp_retries_3 = csd->filler_n_retries[3];
+	cnl->gvstats_base.n_set             = csd->filler_n_puts;
+	cnl->gvstats_base.n_kill            = csd->filler_n_kills;
+	cnl->gvstats_base.n_query           = csd->filler_n_queries;
+	cnl->gvstats_base.n_get             = csd->filler_n_gets;
+	cnl->gvstats_base.n_order           = csd->filler_n_order;
+	cnl->gvstats_base.n_zprev           = csd->filler_n_zprevs;
+	cnl->gvstats_base.n_data            = csd->filler_n_data;
 	/* No longer maintained            : csd->filler_n_puts_duplicate       */
-	cnl->gvstats_rec.n_tp_readwrite    = csd->filler_n_tp_updates;
+	cnl->gvstats_base.n_tp_readwrite    = csd->filler_n_tp_updates;
 	/* No longer maintained            : csd->filler_n_tp_updates_duplicate */
-	cnl->gvstats_rec.n_tp_tot_retries_0 = csd->filler_n_tp_retries[0];
-	cnl->gvstats_rec.n_tp_tot_retries_1 = csd->filler_n_tp_retries[1];
-	cnl->gvstats_rec.n_tp_tot_retries_2 = csd->filler_n_tp_retries[2];
-	cnl->gvstats_rec.n_tp_tot_retries_3 = csd->filler_n_tp_retries[3];
-	cnl->gvstats_rec.n_tp_tot_retries_4 = csd->filler_n_tp_retries[4];
+	cnl->gvstats_base.n_tp_tot_retries_0 = csd->filler_n_tp_retries[0];
+	cnl->gvstats_base.n_tp_tot_retries_1 = csd->filler_n_tp_retries[1];
+	cnl->gvstats_base.n_tp_tot_retries_2 = csd->filler_n_tp_retries[2];
+	cnl->gvstats_base.n_tp_tot_retries_3 = csd->filler_n_tp_retries[3];
+	cnl->gvstats_base.n_tp_tot_retries_4 = csd->filler_n_tp_retries[4];
 	for (index = 5; index < 12; index++)
-		cnl->gvstats_rec.n_tp_tot_retries_4 += csd->filler_n_tp_retries[index];
-	cnl->gvstats_rec.n_tp_cnflct_retries_0 = csd->filler_n_tp_retries_conflicts[0];
-	cnl->gvstats_rec.n_tp_cnflct_retries_1 = csd->filler_n_tp_retries_conflicts[1];
-	cnl->gvstats_rec.n_tp_cnflct_retries_2 = csd->filler_n_tp_retries_conflicts[2];
-	cnl->gvstats_rec.n_tp_cnflct_retries_3 = csd->filler_n_tp_retries_conflicts[3];
-	cnl->gvstats_rec.n_tp_cnflct_retries_4 = csd->filler_n_tp_retries_conflicts[4];
+		cnl->gvstats_base.n_tp_tot_retries_4 += csd->filler_n_tp_retries[index];
+	cnl->gvstats_base.n_tp_cnflct_retries_0 = csd->filler_n_tp_retries_conflicts[0];
+	cnl->gvstats_base.n_tp_cnflct_retries_1 = csd->filler_n_tp_retries_conflicts[1];
+	cnl->gvstats_base.n_tp_cnflct_retries_2 = csd->filler_n_tp_retries_conflicts[2];
+	cnl->gvstats_base.n_tp_cnflct_retries_3 = csd->filler_n_tp_retries_conflicts[3];
+	cnl->gvstats_base.n_tp_cnflct_retries_4 = csd->filler_n_tp_retries_conflicts[4];
 	for (index = 5; index < 12; index++)
-		cnl->gvstats_rec.n_tp_cnflct_retries_4 += csd->filler_n_tp_retries_conflicts[index];
+		cnl->gvstats_base.n_tp_cnflct_retries_4 += csd->filler_n_tp_retries_conflicts[index];
 	/* Nullify statistics that were formerly in use but no longer so */
 	csd->unused_dsk_reads.curr_count = 0;
 	csd->unused_dsk_reads.cumul_count = 0;
@@ -34,4 +34,46 @@ typedef struct gvstats_rec_struct
 } gvstats_rec_t;
 #undef TAB_GVSTATS_REC
 
+/* Latency histograms (maintained only if $ydb_gvstats_latency is set). Bucket 0 counts operations that took less than a
+ * microsecond and bucket N (N > 0) those that took [2**(N-1), 2**N) microseconds. The last bucket also counts anything longer.
+ */
+#define	GVSTATS_LAT_BUCKETS	24
+
+#define	TAB_GVSTATS_LAT(A,B,C)	A,
+enum gvstats_lat_type
+{
+#include "tab_gvstats_lat.h"
+n_gvstats_lat_types
+};
+#undef TAB_GVSTATS_LAT
+
+typedef struct
+{
+	gtm_uint64_t	sum_usec;			/* total of all latencies recorded, for the mean */
+	gtm_uint64_t	bucket[GVSTATS_LAT_BUCKETS];
+} gvstats_lat_t;
+
+/* The database wide statistics in node_local are updated by every process attached to the database. Instead of all of them
+ * incrementing the same counters (and bouncing the same cache lines between CPUs), each process updates one of
+ * GVSTATS_SHARD_CNT cache line aligned copies: the slot it was handed (round robin through cnl->gvstats_shard_next) when it
+ * opened the database, so that the first GVSTATS_SHARD_CNT processes never share one. Readers add up the shards on top of
+ * cnl->gvstats_base, which holds the totals as of the time the shared memory was created or the statistics were reset (see
+ * "gvstats_rec_cnl_sum"). cnl->gvstats_rec keeps its offset for $ZPEEK("NLREG:...") and ^%PEEKBYNAME("node_local.gvstats_rec...")
+ * but is not kept current; $ZPEEK serves those sums in its place from private storage.
+ */
+#define	GVSTATS_SHARD_CNT	16	/* Must be a power of 2 */
+
+#define	GVSTATS_SHARD_SIZE	(SIZEOF(gvstats_rec_t) + (n_gvstats_lat_types * SIZEOF(gvstats_lat_t)))
+
+typedef struct
+{
+	gvstats_rec_t	gvstats_rec;
+	gvstats_lat_t	lat[n_gvstats_lat_types];
+	CACHELINE_PAD(GVSTATS_SHARD_SIZE % CACHELINE_SIZE, 1);	/* keep shards from sharing cache lines */
+} gvstats_shard_t;
+
+gtm_uint64_t	gvstats_lat_now(void);
+gtm_uint64_t	gvstats_lat_count(gvstats_lat_t *lat);
+gtm_uint64_t	gvstats_lat_percentile(gvstats_lat_t *lat, gtm_uint64_t count, int permille);
+
 #endif
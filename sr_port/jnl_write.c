@@ -125,8 +125,10 @@ void	jnl_write(jnl_private_control *jpc, enum jnl_record_type rectype, jnl_recor
 	uint4			end_freeaddr;
 	int4			blocking_pid;
 #	endif
+	gtm_uint64_t		lat_start;
 
 	assert(MAX_JNL_WRITE_RECURSION_DEPTH > jnl_write_recursion_depth++);
+	GVSTATS_LAT_START(lat_start);
 	reg = jpc->region;
 	csa = &FILE_INFO(reg)->s_addrs;
 	jb = jpc->jnl_buff;
@@ -506,5 +508,6 @@ void	jnl_write(jnl_private_control *jpc, enum jnl_record_type rectype, jnl_recor
 		jpc->phase2_freeaddr = jpc->new_freeaddr;
 		jpc->phase2_free = lcl_free;
 	}
+	GVSTATS_LAT_END(csa, lat_jnl_write, lat_start);
 	DEBUG_ONLY(jnl_write_recursion_depth--);
 }
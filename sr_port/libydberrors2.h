@@ -44,3 +44,5 @@
 #define YDB_ERR_THREADEDAPINOTALLOWED -151027946
 #define YDB_ERR_SIMPLEAPINOTALLOWED -151027954
 #define YDB_ERR_STAPIFORKEXEC -151027962
+#define YDB_ERR_SNAPSHOTFAIL -151027970
+#define YDB_ERR_SNAPSHOTNOTALLOWED -151027978
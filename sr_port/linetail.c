@@ -11,39 +11,74 @@
  ****************************************************************/
 
 #include "mdef.h"
+#include "mdq.h"
 #include "compiler.h"
 #include "toktyp.h"
 #include "opcode.h"
 #include "advancewindow.h"
 #include "cmd.h"
 
+GBLREF	int4		pending_errtriplecode;
+
 error_def(ERR_CMD);
 error_def(ERR_SPOREOL);
 
 int linetail(void)
 {
+	int		rval;
+	int4		save_errtriplecode;
+	triple		linepos_in_chain, *oldchain, tmpchain;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	TREF(rts_error_in_parse) = FALSE;
+	oldchain = NULL;
 	for (;;)
 	{
 		while (TK_SPACE == TREF(window_token))
 			advancewindow();
 		if (TK_EOL == TREF(window_token))
-			return TRUE;
+		{
+			rval = TRUE;
+			break;
+		}
 		if (!cmd())
 		{
 			if (!ALREADY_RTERROR)
 				TREF(source_error_found) ? stx_error(TREF(source_error_found)) : stx_error(ERR_CMD);
 			assert((TREF(curtchain))->exorder.bl->exorder.fl == TREF(curtchain));
 			assert(TREF(source_error_found));
-			return FALSE;
+			rval = FALSE;
+			break;
 		}
 		if ((TK_SPACE != TREF(window_token)) && (TK_EOL != TREF(window_token)))
 		{
 			stx_error(ERR_SPOREOL);
-			return FALSE;
+			rval = FALSE;
+			break;
 		}
+		if (TREF(cmd_xfer_uncond))
+		{	/* An unconditional QUIT or GOTO means control never reaches the rest of the line, so parse it (to report
+			 * any errors) onto a discard chain as for an IF with a literal FALSE argument and generate no code for it
+			 */
+			TREF(cmd_xfer_uncond) = FALSE;
+			if ((NULL == oldchain) && (TK_EOL != TREF(window_token)))
+			{
+				linepos_in_chain = TREF(pos_in_chain);
+				save_errtriplecode = pending_errtriplecode;
+				dqinit(&tmpchain, exorder);
+				oldchain = setcurtchain(&tmpchain);
+			}
+		}
+	}
+	if (NULL != oldchain)
+	{	/* drop the dead code along with any error it had (already reported) as it can never execute */
+		while (TK_EOL != TREF(window_token))
+			advancewindow();
+		pending_errtriplecode = save_errtriplecode;
+		TREF(pos_in_chain) = linepos_in_chain;
+		setcurtchain(oldchain);
+		rval = TRUE;
 	}
+	return rval;
 }
@@ -50,6 +50,7 @@ void lke_growhash(void)
 	int			regidx;
 	boolean_t		was_crit;
 	mlk_pvtctl		pctl;
+	mlk_shrhash_seg		seg;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -75,8 +76,9 @@ void lke_growhash(void)
 			match = TRUE;
 			/* Construct a dummy pctl to pass in */
 			MLK_PVTCTL_INIT(pctl, reg);
+			mlk_shrhash_resize_prep(&pctl, &seg);
 			GRAB_LOCK_CRIT_AND_SYNC(pctl, was_crit);
-			resize_status = mlk_shrhash_resize(&pctl);
+			resize_status = mlk_shrhash_resize(&pctl, &seg);
 			REL_LOCK_CRIT(pctl, was_crit);
 			util_out_print("Resize of lock hash memory !AZ for region !AD", TRUE,
 					(resize_status ? "succeeded" : "FAILED"), REG_LEN_STR(reg));
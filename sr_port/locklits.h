@@ -26,3 +26,4 @@
 #define NOT_THERE -1
 
 #define LOCK_SELF_WAKE		 100	/* sleep 100 msec before checking if wakeup was sent by lock holder */
+#define LOCK_SELF_WAKE_MIN	   1	/* first (shortest) sleep while blocked; doubles up to LOCK_SELF_WAKE */
@@ -23,6 +23,7 @@
 int m_goto(void)
 /* compiler module for (ugh!) GOTO */
 {
+	opctype	opc;
 	triple	*obp, *oldchain, tmpchain;
 	DCL_THREADGBL_ACCESS;
 
@@ -39,6 +40,9 @@ int m_goto(void)
 	setcurtchain(oldchain);
 	if (TK_COLON == TREF(window_token))
 		return m_goto_postcond(oldchain, &tmpchain);		/* post conditional expression */
+	opc = tmpchain.exorder.bl->opcode;
+	if ((OC_JMP == opc) || (OC_EXTJMP == opc))
+		TREF(cmd_xfer_uncond) = TRUE;	/* direct label: unlike indirection, it cannot supply a FALSE postconditional */
 	obp = oldchain->exorder.bl;
 	dqadd(obp, &tmpchain, exorder);					/*this violates info hiding*/
 	return TRUE;
@@ -44,6 +44,7 @@ int m_quit(void)
 		if (!arg)
 		{
 			newtriple((run_time) ? OC_HARDRET : OC_RET);
+			TREF(cmd_xfer_uncond) = TRUE;
 			return TRUE;
 		}
 		/* We now know we have an arg. See if it is an alias indicated arg */
@@ -57,6 +58,7 @@ int m_quit(void)
 				r = newtriple(OC_RETARG);
 				r->operand[0] = tmparg;
 				r->operand[1] = put_ilit(TRUE);
+				TREF(cmd_xfer_uncond) = TRUE;
 				return TRUE;
 			} else
 			{	/* Unexpected text after alias indicator */
@@ -72,6 +74,7 @@ int m_quit(void)
 				r->operand[1] = put_ilit(FALSE);
 			} else	/* Indirect argument */
 				make_commarg(&x, indir_quit);
+			TREF(cmd_xfer_uncond) = TRUE;
 			return TRUE;
 		}
 		if (TK_COMMA == TREF(window_token))
@@ -81,6 +84,7 @@ int m_quit(void)
 	{
 		triptr = newtriple(OC_JMP);
 		FOR_END_OF_SCOPE(1, triptr->operand[0]);
+		TREF(cmd_xfer_uncond) = TRUE;
 		return TRUE;
 	}
 	stx_error(ERR_QUITARGUSE);
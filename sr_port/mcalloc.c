@@ -59,11 +59,14 @@ char *mcalloc(unsigned int n)
 			mcavailptr->link = hdr;
 		}
 		assert(n <= hdr->size);
-		memset(&hdr->data[0], 0, hdr->size);
 		mcavailptr = hdr;
 		mcavail = hdr->size;
 	}
 	mcavail -= n;
 	assert(mcavail >= 0);
+	/* Callers expect zeroed storage. Clear only what is handed out rather than each block as it is (re)entered, since
+	 * most indirection/XECUTE compiles use a small fraction of the first block and this is done for every one of them.
+	 */
+	memset(&mcavailptr->data[mcavail], 0, n);
 	return &mcavailptr->data[mcavail];
 }
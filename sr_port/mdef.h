@@ -1252,8 +1252,10 @@ typedef INTPTR_T  ptroff_t;
 
 #ifdef CACHELINE_SIZE
 # define CACHELINE_PAD(fieldSize, fillnum) char fill_cacheline##fillnum[CACHELINE_SIZE - (fieldSize)]
+# define CACHELINE_ALIGNED __attribute__((aligned(CACHELINE_SIZE)))	/* field starts a cache line; same restrictions */
 #else
 # define CACHELINE_PAD(fieldSize, fillnum)
+# define CACHELINE_ALIGNED
 #endif
 
 /* In certain cases we need to conditionally do a CACHELINE pad. For those platforms that
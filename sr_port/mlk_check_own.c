@@ -52,6 +52,15 @@ boolean_t	mlk_check_own(mlk_pvtblk *x)
 	if (!x->blocked)
 		return FALSE;
 	csa = x->pvtctl.csa;
+	/* Shrblks stay mapped for the life of the lock space so peek at the blocking node without lock crit first. If it is
+	 * still held, by the same owner incarnation (sequence), and that owner is alive there is nothing to clear and no need to
+	 * contend for crit; a stale read here only means that the answer could have been TRUE a moment earlier or later, which
+	 * the caller sees on its next check anyway. Only an apparently free, reused or abandoned node is confirmed in crit.
+	 */
+	if (((volatile mlk_shrblk *)x->blocked)->owner
+			&& (((volatile mlk_shrblk *)x->blocked)->sequence == x->blk_sequence)
+			&& !BLOCKING_PROC_DEAD(x, time, icount, status))
+		return FALSE;
 	GRAB_LOCK_CRIT_AND_SYNC(x->pvtctl, was_crit);
 	assert((csa->lock_crit_with_db) || !csa->now_crit || (CDB_STAGNATE <= t_tries));
 	ret_val = FALSE;
@@ -48,6 +48,7 @@
 #include "mlk_shrblk_find.h"
 #include "mlk_shrhash_resize.h"
 #include "mlk_lock.h"
+#include "mlk_wake_pending.h"
 #include "t_retry.h"
 #include "gvusr.h"
 #include "interlock.h"
@@ -86,6 +87,7 @@ uint4 mlk_lock(mlk_pvtblk *p,
 	boolean_t		blocked, was_crit, added;
 	sgmnt_addrs		*csa;
 	connection_struct	*curr_entry;	/* for GT.CM GNP server */
+	mlk_shrhash_seg		seg;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -99,6 +101,7 @@ uint4 mlk_lock(mlk_pvtblk *p,
 			/* make sure this region is in the list in case we end up retrying */
 			insert_region(p->pvtctl.region, &tp_reg_list, &tp_reg_free_list, SIZEOF(tp_region));
 		}
+		mlk_wake_defer_start();		/* Fairness nudges from mlk_shrblk_find are sent after lock crit is released */
 		GRAB_LOCK_CRIT_AND_SYNC(p->pvtctl, was_crit);
 		retval = ctl->wakeups;
 		assert(retval);
@@ -113,12 +116,20 @@ uint4 mlk_lock(mlk_pvtblk *p,
 		{
 			REL_LOCK_CRIT(p->pvtctl, was_crit);
 			prepare_for_gc(&p->pvtctl);
+			seg.shmid = -1;
+			if (ctl->resize_needed)		/* Unlocked peek - only decides whether to get the new segment early */
+				mlk_shrhash_resize_prep(&p->pvtctl, &seg);
 			GRAB_LOCK_CRIT_AND_SYNC(p->pvtctl, was_crit);
 			assert(ctl->lock_gc_in_progress.u.parts.latch_pid == process_id);
 			if (ctl->resize_needed)
-				mlk_shrhash_resize(&p->pvtctl);
-			else if (ctl->gc_needed || (ctl->subtop - ctl->subfree < siz) || (ctl->blkcnt < p->subscript_cnt))
-				mlk_garbage_collect(p, siz, FALSE);
+				mlk_shrhash_resize(&p->pvtctl, &seg);
+			else
+			{
+				if (-1 != seg.shmid)
+					mlk_shrhash_resize_unprep(&p->pvtctl, &seg);
+				if (ctl->gc_needed || (ctl->subtop - ctl->subfree < siz) || (ctl->blkcnt < p->subscript_cnt))
+					mlk_garbage_collect(p, siz, FALSE);
+			}
 			assert(ctl->lock_gc_in_progress.u.parts.latch_pid == process_id);
 			RELEASE_SWAPLOCK(&ctl->lock_gc_in_progress);
 		}
@@ -195,6 +206,7 @@ uint4 mlk_lock(mlk_pvtblk *p,
 					(ctl->subfree - ctl->subbase), (ctl->subtop - ctl->subbase));
 		}
 		REL_LOCK_CRIT(p->pvtctl, was_crit);
+		mlk_wake_defer_send();
 		if (!retval)
 		{
 			INCR_GVSTATS_COUNTER(csa, csa->nl, n_lock_success, 1);
@@ -32,7 +32,43 @@ error_def(ERR_MLKHASHRESIZEFAIL);
 #define SHRHASH_PAGE_SIZE		(gtm_uint8)(2 * 1024 * 1024)
 #define NEW_SHRHASH_MEM(SHRHASH_SIZE)	ROUND_UP((SHRHASH_SIZE) * SIZEOF(mlk_shrhash) * 5 / 4, SHRHASH_PAGE_SIZE)
 
-boolean_t mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl)
+/* Get and attach the segment for the next size of the hash table, and touch its pages, without holding lock crit so
+ * that the system calls and page faults of a resize do not stall every other LOCK in the region. The table is sized
+ * from the current num_blkhash; mlk_shrhash_resize() discards the segment if the table was resized in the meantime.
+ * On failure seg->shmid is -1 and mlk_shrhash_resize() gets the segment itself (and reports any error).
+ */
+void mlk_shrhash_resize_prep(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg)
+{
+	seg->size_old = pctl->ctl->num_blkhash;
+	seg->mem = NEW_SHRHASH_MEM(seg->size_old);
+	seg->shrhash = NULL;
+	if (-1 == (seg->shmid = shmget(IPC_PRIVATE, seg->mem, RWDALL | IPC_CREAT)))
+		return;
+	if (NULL == (seg->shrhash = do_shmat(seg->shmid, NULL, 0)))
+	{
+		shm_rmid(seg->shmid);		/* Ignore error return, the resize will retry and report */
+		seg->shmid = -1;
+		return;
+	}
+	memset(seg->shrhash, 0, seg->mem);	/* Fault in the (already zero) pages now rather than in crit */
+}
+
+/* Release a segment from mlk_shrhash_resize_prep() that was not used */
+void mlk_shrhash_resize_unprep(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg)
+{
+	if (-1 == seg->shmid)
+		return;
+	if (-1 == SHMDT(seg->shrhash))
+		send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8) ERR_SYSCALL, 5, LEN_AND_LIT("shmdt"), CALLFROM, errno, 0);
+	if (-1 == shm_rmid(seg->shmid))
+		send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8) ERR_SYSCALL, 5, LEN_AND_LIT("shm_rmid"), CALLFROM, errno, 0);
+	seg->shmid = -1;
+}
+
+/* Rebuild the hash table into a larger segment. If "seg" is non-NULL, it is a segment from mlk_shrhash_resize_prep()
+ * which is used if it was sized for the current table (else released); either way it is consumed.
+ */
+boolean_t mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg)
 {
 	mlk_shrhash_ptr_t	shrhash_old, shrhash_new, old_bucket, new_bucket, free_bucket;
 	int			obi, shmid_new, shmid_old, nbi, fi, save_errno, status;
@@ -44,26 +80,36 @@ boolean_t mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl)
 	shrhash_size_old = pctl->ctl->num_blkhash;
 	shrhash_mem_new = NEW_SHRHASH_MEM(shrhash_size_old);
 	shrhash_size_new = shrhash_mem_new / SIZEOF(mlk_shrhash);
+	if ((NULL != seg) && (-1 != seg->shmid) && (seg->size_old != shrhash_size_old))
+		mlk_shrhash_resize_unprep(pctl, seg);	/* Someone else resized since; this one is the wrong size */
 	do
 	{
-		shmid_new = shmget(IPC_PRIVATE, shrhash_mem_new, RWDALL | IPC_CREAT);
-		assert(-1 != shmid_new);
-		if (-1 == shmid_new)
+		if ((NULL != seg) && (-1 != seg->shmid))
+		{	/* Use the segment obtained outside of crit */
+			assert(seg->mem == shrhash_mem_new);
+			shmid_new = seg->shmid;
+			shrhash_new = seg->shrhash;
+			seg->shmid = -1;
+		} else
 		{
-			send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8)
-					ERR_SYSCALL, 5, LEN_AND_LIT("shmget"), CALLFROM, errno, 0);
-			return FALSE;
-		}
-
-		shrhash_new = do_shmat(shmid_new, NULL, 0);
-		assert(NULL != shrhash_new);
-		if (NULL == shrhash_new)
-		{
-			save_errno = errno;
-			shm_rmid(shmid_new);		/* Ignore error return, as we are already in error state. */
-			send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8)
-					ERR_SYSCALL, 5, LEN_AND_LIT("shmat"), CALLFROM, save_errno, 0);
-			return FALSE;
+			shmid_new = shmget(IPC_PRIVATE, shrhash_mem_new, RWDALL | IPC_CREAT);
+			assert(-1 != shmid_new);
+			if (-1 == shmid_new)
+			{
+				send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8)
+						ERR_SYSCALL, 5, LEN_AND_LIT("shmget"), CALLFROM, errno, 0);
+				return FALSE;
+			}
+			shrhash_new = do_shmat(shmid_new, NULL, 0);
+			assert(NULL != shrhash_new);
+			if (NULL == shrhash_new)
+			{
+				save_errno = errno;
+				shm_rmid(shmid_new);		/* Ignore error return, as we are already in error state. */
+				send_msg_csa(CSA_ARG(pctl->csa) VARLSTCNT(8)
+						ERR_SYSCALL, 5, LEN_AND_LIT("shmat"), CALLFROM, save_errno, 0);
+				return FALSE;
+			}
 		}
 
 		shrhash_old = pctl->shrhash;
@@ -9,4 +9,20 @@
  *	the license, please stop and do not read further.	*
  *								*
  ****************************************************************/
-boolean_t mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl);
+#ifndef MLK_SHRHASH_RESIZE_INCLUDED
+#define MLK_SHRHASH_RESIZE_INCLUDED
+
+/* A new (larger) hash table segment obtained by mlk_shrhash_resize_prep() outside of lock crit */
+typedef struct
+{
+	int			shmid;		/* -1 if none */
+	mlk_shrhash_ptr_t	shrhash;
+	uint4			size_old;	/* num_blkhash the segment was sized for */
+	size_t			mem;
+} mlk_shrhash_seg;
+
+void		mlk_shrhash_resize_prep(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg);
+void		mlk_shrhash_resize_unprep(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg);
+boolean_t	mlk_shrhash_resize(mlk_pvtctl_ptr_t pctl, mlk_shrhash_seg *seg);
+
+#endif
@@ -70,6 +70,7 @@ void mlk_unlock(mlk_pvtblk *p)
 			/* make sure this region is in the list in case we end up retrying */
 			insert_region(p->pvtctl.region, &tp_reg_list, &tp_reg_free_list, SIZEOF(tp_region));
 		}
+		mlk_wake_defer_start();
 		GRAB_LOCK_CRIT_AND_SYNC(p->pvtctl, was_crit);
 		if (d->owner == process_id && p->sequence == d->sequence)
 		{
@@ -98,6 +99,7 @@ void mlk_unlock(mlk_pvtblk *p)
 		if (ls_free >= LOCK_SPACE_FULL_SYSLOG_THRESHOLD)
 			ctl->lockspacefull_logged = FALSE; /* Allow syslog writes if enough free space is established. */
 		REL_LOCK_CRIT(p->pvtctl, was_crit);
+		mlk_wake_defer_send();		/* Wake the next waiter(s) now that others can get lock crit */
 	} else	/* acc_meth == dba_usr */
 		gvusr_unlock(p->nref_length, &p->value[0], p->pvtctl.region);
 	return;
@@ -35,10 +35,26 @@
 
 GBLREF uint4 process_id;
 
+STATICDEF boolean_t	wake_defer_active;
+STATICDEF int		wake_defer_cnt;
+STATICDEF uint4		wake_defer_pid[MLK_WAKE_DEFER_MAX];
+STATICDEF int		wake_defer_gone_cnt;
+STATICDEF uint4		wake_defer_gone_pid[MLK_WAKE_DEFER_MAX];	/* Deferred wake targets of the last batch found gone */
+
+STATICFNDCL boolean_t mlk_wake_defer_gone(uint4 pid);
+
 #define NODENUMBER 0xFFE00000
 #define DO_CRIT_WAKE										\
 {												\
-	crit_wake_res = pr->process_id ? crit_wake((sm_uint_ptr_t)&pr->process_id) : GONE;	\
+	if (pr->process_id && wake_defer_active && (MLK_WAKE_DEFER_MAX > wake_defer_cnt)	\
+		&& !mlk_wake_defer_gone(pr->process_id))					\
+	{	/* Send it once out of lock crit. If the process is gone by then, it is noted	\
+		 * so the next wake for it is sent right away and cleans up its prcblk.		\
+		 */										\
+		wake_defer_pid[wake_defer_cnt++] = pr->process_id;				\
+		crit_wake_res = 0;								\
+	} else											\
+		crit_wake_res = pr->process_id ? crit_wake((sm_uint_ptr_t)&pr->process_id) : GONE; \
 	if (GONE == crit_wake_res)								\
 	{											\
 		pr->ref_cnt = 1;								\
@@ -83,3 +99,43 @@ void mlk_wake_pending(mlk_pvtctl_ptr_t pctl, mlk_shrblk_ptr_t d)
 	assertpro(lcnt);
 	return;
 }
+
+STATICFNDEF boolean_t mlk_wake_defer_gone(uint4 pid)
+{
+	int	i;
+
+	for (i = 0; i < wake_defer_gone_cnt; i++)
+	{
+		if (pid == wake_defer_gone_pid[i])
+			return TRUE;
+	}
+	return FALSE;
+}
+
+void mlk_wake_defer_start(void)
+{
+	/* An error between the previous mlk_wake_defer_start() and mlk_wake_defer_send() (e.g. a rts_error while holding
+	 * lock crit) can leave that batch unsent. Send it now (we do not hold lock crit yet) so those waiters are not left
+	 * sleeping until their timeout, and start the new batch from a clean slate.
+	 */
+	if (wake_defer_active || wake_defer_cnt)
+		mlk_wake_defer_send();
+	assert(!wake_defer_cnt);
+	wake_defer_active = TRUE;
+}
+
+void mlk_wake_defer_send(void)
+{
+	int	i;
+
+	wake_defer_active = FALSE;
+	if (!wake_defer_cnt)
+		return;		/* Keep the gone pids of the last batch that sent anything */
+	wake_defer_gone_cnt = 0;
+	for (i = 0; i < wake_defer_cnt; i++)
+	{
+		if (GONE == crit_wake((sm_uint_ptr_t)&wake_defer_pid[i]))
+			wake_defer_gone_pid[wake_defer_gone_cnt++] = wake_defer_pid[i];
+	}
+	wake_defer_cnt = 0;
+}
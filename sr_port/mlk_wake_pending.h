@@ -13,6 +13,14 @@
 #ifndef MLK_WAKE_PENDING_INCLUDED
 #define MLK_WAKE_PENDING_INCLUDED
 
+/* Between mlk_wake_defer_start() and mlk_wake_defer_send(), up to MLK_WAKE_DEFER_MAX wakeups are only noted by
+ * mlk_wake_pending() and are then sent by mlk_wake_defer_send(), which is meant to be called once lock crit is released.
+ * This keeps the kill() system calls out of lock crit. Wakeups beyond the limit are sent right away as before.
+ */
+#define MLK_WAKE_DEFER_MAX	16
+
 void mlk_wake_pending(mlk_pvtctl_ptr_t pctl, mlk_shrblk_ptr_t d);
+void mlk_wake_defer_start(void);
+void mlk_wake_defer_send(void);
 
 #endif /* MLK_WAKE_PENDING_INCLUDED */
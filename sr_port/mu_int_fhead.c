@@ -153,6 +153,11 @@ boolean_t mu_int_fhead(void)
                 gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUKILLIP, 4, DB_LEN_STR(gv_cur_region), LEN_AND_LIT("MUPIP INTEG"));
                 mu_int_errknt++;
         }
+	if (0 != mu_data->defer_free_cnt)
+	{	/* The detached subtrees awaiting MUPIP REORG -FREE_DEFERRED show up as incorrectly marked busy */
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUKILLIP, 4, DB_LEN_STR(gv_cur_region), LEN_AND_LIT("MUPIP INTEG"));
+		mu_int_errknt++;
+	}
         if (0 != mu_data->abandoned_kills)
         {
                 gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_KILLABANDONED, 4, DB_LEN_STR(gv_cur_region),
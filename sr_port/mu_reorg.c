@@ -74,7 +74,9 @@
 #ifdef UNIX
 #include "repl_msg.h"
 #include "gtmsource.h"
+#include "gtm_multi_proc.h"
 #endif
+#include "mmemory.h"		/* for memvcmp prototype */
 
 GBLREF	bool			mu_ctrlc_occurred;
 GBLREF	bool			mu_ctrly_occurred;
@@ -97,6 +99,7 @@ GBLREF	sgmnt_addrs		*kip_csa;
 GBLREF	boolean_t		need_kip_incr;
 GBLREF	uint4			update_trans;
 GBLREF	boolean_t		mu_reorg_in_swap_blk;
+GBLREF	uint4			mu_reorg_blks_per_sec;
 
 error_def(ERR_DBRDONLY);
 error_def(ERR_GBLNOEXIST);
@@ -105,18 +108,24 @@ error_def(ERR_MUREORGFAIL);
 
 #define SAVE_REORG_RESTART													\
 {																\
-	cs_data->reorg_restart_block = dest_blk_id;										\
-	if (OLD_MAX_KEY_SZ >= gv_currkey->end)											\
-		memcpy(&cs_data->reorg_restart_key[0], &gv_currkey->base[0], gv_currkey->end + 1);				\
-	else															\
-	{	/* Save only so much of gv_currkey as will fit in reorg_restart_key. Expect this to be no more than a very	\
-		 * minor inconvenience for those using -RESUME */								\
-		memcpy(&cs_data->reorg_restart_key[0], &gv_currkey->base[0], OLD_MAX_KEY_SZ + 1);				\
-		cs_data->reorg_restart_key[OLD_MAX_KEY_SZ] = 0;									\
-		cs_data->reorg_restart_key[OLD_MAX_KEY_SZ - 1] = 0;								\
+	if (!key_range)	/* -PARALLEL workers do not support -RESUME so leave the restart point alone */			\
+	{															\
+		cs_data->reorg_restart_block = dest_blk_id;									\
+		if (OLD_MAX_KEY_SZ >= gv_currkey->end)										\
+			memcpy(&cs_data->reorg_restart_key[0], &gv_currkey->base[0], gv_currkey->end + 1);			\
+		else														\
+		{	/* Save only so much of gv_currkey as will fit in reorg_restart_key. Expect this to be no more than a	\
+			 * very minor inconvenience for those using -RESUME */							\
+			memcpy(&cs_data->reorg_restart_key[0], &gv_currkey->base[0], OLD_MAX_KEY_SZ + 1);			\
+			cs_data->reorg_restart_key[OLD_MAX_KEY_SZ] = 0;								\
+			cs_data->reorg_restart_key[OLD_MAX_KEY_SZ - 1] = 0;							\
+		}														\
 	}															\
 }
 
+/* Seconds between the progress reports of a MUPIP REORG -PARALLEL worker */
+#define	REORG_PROGRESS_SECS	60
+
 #ifdef UNIX
 # define ABORT_TRANS_IF_GBL_EXIST_NOMORE_AND_RETURN(LCL_T_TRIES, GN)								\
 {																\
@@ -202,11 +211,15 @@ Input/Output Parameter:
 	resume = resume flag
 	reorg_op = What operations to do (coalesce or, swap or, split) [Default is all]
 			[Only for debugging]
+	begin_key, end_key = If non-NULL, only reorganize the data blocks starting with the one that begin_key would be
+			found in and ending with the last one whose first key is not greater than end_key. Used by the
+			MUPIP REORG -PARALLEL workers (see mu_reorg_parallel), which split and coalesce but neither
+			save a restart point nor reduce levels.
  ****************************************************************/
 boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
-				int index_fill_factor, int data_fill_factor, int reorg_op)
+				int index_fill_factor, int data_fill_factor, int reorg_op, gv_key *begin_key, gv_key *end_key)
 {
-	boolean_t		end_of_tree = FALSE, complete_merge, detailed_log;
+	boolean_t		end_of_tree = FALSE, complete_merge, detailed_log, key_range, release_latch;
 	int			rec_size;
 	/*
 	 *
@@ -234,12 +247,15 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 	trans_num		ret_tn;
 	mstr			*gn;
 	uint4			sleep_nsec;
+	gtm_uint64_t		due_nsec, now_nsec, report_nsec, start_nsec;
 #	ifdef UNIX
 	DEBUG_ONLY(unsigned int	lcl_t_tries;)
 #	endif
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
+	key_range = ((NULL != begin_key) || (NULL != end_key));
+	assert(!key_range || !*resume);
 	t_err = ERR_MUREORGFAIL;
 	kill_set_tail = &kill_set_list;
 	inctn_opcode = inctn_invalid_op; /* temporary reset; satisfy an assert in t_end() */
@@ -271,6 +287,10 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
  		if (altkeylen && (altkeylen == gn->len) && (0 == memcmp(gv_altkey->base, gn->addr, gn->len)))
 			/* Going to resume from current global, so it resumed and make it false */
 			*resume = FALSE;
+	} else if (NULL != begin_key)
+	{	/* start from the leaf holding begin_key */
+		memcpy(&gv_currkey->base[0], &begin_key->base[0], begin_key->end + 1);
+		gv_currkey->end = begin_key->end;
 	} else
 	{	/* start from the left most leaf */
 		memcpy(&gv_currkey->base[0], gn->addr, gn->len);
@@ -297,6 +317,8 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 	i_toler = (double) INDEX_FILL_TOLERANCE * blk_size / 100.0;
 	blks_killed = blks_processed = blks_reused = lvls_reduced = blks_coalesced = blks_split = blks_swapped = 0;
 	pre_order_successor_level = level = MAX_BT_DEPTH + 1; /* Just some high value to initialize */
+	start_nsec = gvstats_lat_now();
+	report_nsec = start_nsec + ((gtm_uint64_t)REORG_PROGRESS_SECS * NANOSECS_IN_SEC);
 
 	/* --- more detailed debugging information --- */
 	if (detailed_log = reorg_op & DETAIL)
@@ -628,6 +650,9 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 		else
 		{
 			level = pre_order_successor_level;
+			if ((NULL != end_key) && (0 < memvcmp(&gv_currkey_next_reorg->base[0], gv_currkey_next_reorg->end + 1,
+					&end_key->base[0], end_key->end + 1)))
+				break;	/* the next data block is in the key range of the next worker */
 			memcpy(&gv_currkey->base[0], &gv_currkey_next_reorg->base[0], gv_currkey_next_reorg->end + 1);
 			gv_currkey->end =  gv_currkey_next_reorg->end;
 			SAVE_REORG_RESTART;
@@ -639,7 +664,29 @@ boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
 		assert((0 <= sleep_nsec) && (NANOSECS_IN_SEC > sleep_nsec));
 		if (sleep_nsec)
 			NANOSLEEP(sleep_nsec, RESTART_TRUE);
+		if (mu_reorg_blks_per_sec || key_range)
+		{
+			now_nsec = gvstats_lat_now();
+			if (key_range && (now_nsec >= report_nsec))
+			{	/* let the operator see how far each -PARALLEL worker has got */
+				GRAB_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+				util_out_print("Blocks processed so far : !SL (coalesced !SL, split !SL)", FLUSH,
+					blks_processed, blks_coalesced, blks_split);
+				REL_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
+				report_nsec = now_nsec + ((gtm_uint64_t)REORG_PROGRESS_SECS * NANOSECS_IN_SEC);
+			}
+			/* -RATE: sleep until blks_processed is no more than the rate allows for the time since we started */
+			due_nsec = start_nsec + ((gtm_uint64_t)blks_processed * NANOSECS_IN_SEC / MAX(mu_reorg_blks_per_sec, 1));
+			if (mu_reorg_blks_per_sec && (due_nsec > now_nsec))
+				NANOSLEEP(MIN(due_nsec - now_nsec, NANOSECS_IN_SEC - 1), RESTART_TRUE);
+		}
 	}	/* ================ END MAIN LOOP ================ */
+	if (key_range)
+	{	/* Levels are reduced by the pass over the whole global that follows the -PARALLEL workers */
+		reorg_finish(dest_blk_id, blks_processed, blks_killed, blks_reused,
+				file_extended, lvls_reduced, blks_coalesced, blks_split, blks_swapped);
+		return TRUE;
+	}
 
 	/* =========== START REDUCE LEVEL ============== */
 	memcpy(&gv_currkey->base[0], gn->addr, gn->len);
@@ -714,8 +761,11 @@ void reorg_finish(block_id dest_blk_id, int blks_processed, int blks_killed,
 	int blks_reused, int file_extended, int lvls_reduced,
 	int blks_coalesced, int blks_split, int blks_swapped)
 {
+	boolean_t	release_latch;
+
 	t_abort(gv_cur_region, cs_addrs);
 	file_extended = cs_data->trans_hist.total_blks - file_extended;
+	GRAB_MULTI_PROC_LATCH_IF_NEEDED(release_latch);	/* keep the lines of a -PARALLEL worker together */
 	util_out_print("Blocks processed    : !SL ", FLUSH, blks_processed);
 	util_out_print("Blocks coalesced    : !SL ", FLUSH, blks_coalesced);
 	util_out_print("Blocks split        : !SL ", FLUSH, blks_split);
@@ -727,6 +777,7 @@ void reorg_finish(block_id dest_blk_id, int blks_processed, int blks_killed,
 	else if (0 < lvls_reduced)
 		util_out_print("Levels Eliminated   : !SL ", FLUSH, lvls_reduced);
 	util_out_print("Blocks extended     : !SL ", FLUSH, file_extended);
+	REL_MULTI_PROC_LATCH_IF_NEEDED(release_latch);
 	cs_addrs->reorg_last_dest = dest_blk_id;
 	/* next attempt for this global will start from the beginning, if RESUME option is present */
 	cs_data->reorg_restart_block = 0;
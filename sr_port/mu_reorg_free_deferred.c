@@ -0,0 +1,185 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "gdscc.h"
+#include "gdskill.h"
+#include "jnl.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "tp.h"
+#include "interlock.h"
+#include "iosp.h"		/* for SS_NORMAL */
+#include "min_max.h"
+#include "repl_msg.h"		/* for gtmsource.h */
+#include "gtmsource.h"		/* for jnlpool_addrs_ptr_t */
+
+/* Prototypes */
+#include "gtmmsg.h"		/* for gtm_putmsg prototype */
+#include "gvcst_expand_free_subtree.h"
+#include "gvcst_protos.h"	/* for gvcst_init prototype */
+#include "mu_getlst.h"
+#include "mu_reorg_free_deferred.h"
+#include "mupip_exit.h"
+#include "sleep_cnt.h"
+#include "util.h"		/* for util_out_print prototype */
+#include "wcs_sleep.h"
+
+/* Number of detached subtrees MUPIP REORG -FREE_DEFERRED frees per trip through crit */
+#define	DEFER_FREE_BATCH	8
+
+GBLREF	bool			error_mupip;
+GBLREF	bool			mu_ctrlc_occurred;
+GBLREF	bool			mu_ctrly_occurred;
+GBLREF	gd_region		*gv_cur_region;
+GBLREF	inctn_opcode_t		inctn_opcode;
+GBLREF	kill_set		*kill_set_tail;
+GBLREF	sgmnt_addrs		*cs_addrs;
+GBLREF	sgmnt_addrs		*kip_csa;
+GBLREF	sgmnt_data_ptr_t	cs_data;
+GBLREF	tp_region		*grlist;
+
+error_def(ERR_MUNOACTION);
+error_def(ERR_MUNOFINISH);
+error_def(ERR_REORGCTRLY);
+
+/* MUPIP REORG -FREE_DEFERRED -REGION <region-list>
+ *
+ * Frees the blocks of the subtrees that KILLs run with $ydb_kill_defer_free detached but left marked busy (see
+ * gvcst_defer_free_subtree). Each batch is popped off csd->defer_free_blk[] while holding crit and kill_in_prog is incremented
+ * in the same critical section, so a MUPIP STOP or crash part way through a batch leaves it counted as an abandoned kill (the
+ * blocks stay incorrectly marked busy until MUPIP INTEG fixes the maps) exactly as for an interrupted KILL. The blocks are then
+ * freed by gvcst_expand_free_subtree outside crit, in the same bitmap sized transactions a KILL uses. Honors the region's
+ * REORG_SLEEP_NSEC between batches and waits out online BACKUP/INTEG the same way a KILL does.
+ */
+void	mu_reorg_free_deferred(void)
+{
+	blk_ident		*ksb;
+	gd_region		*reg;
+	int			cnt, idx;
+	int4			status;
+	kill_set		ks_head, *ks, *next_ks;
+	node_local_ptr_t	cnl;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	tp_region		*rptr;
+	uint4			sleep_counter, sleep_nsec, subtrees;
+
+	status = SS_NORMAL;
+	error_mupip = FALSE;
+	gvinit();	/* initialize gd_header (needed by the later call to mu_getlst) */
+	mu_getlst("REG_NAME", SIZEOF(tp_region)); /* get the parm for the REGION qualifier */
+	if (error_mupip)
+	{
+		util_out_print("!/MUPIP REORG -FREE_DEFERRED cannot proceed with above errors!/", TRUE);
+		mupip_exit(ERR_MUNOACTION);
+	}
+	for (rptr = grlist;  NULL != rptr;  rptr = rptr->fPtr)
+	{
+		if (mu_ctrly_occurred || mu_ctrlc_occurred)
+			break;
+		reg = rptr->reg;
+		if (reg_cmcheck(reg))
+		{
+			util_out_print("Region !AD : MUPIP REORG -FREE_DEFERRED cannot run across network", TRUE, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		gvcst_init(reg);
+		if (reg->was_open)	/* Already open under another name.  Region will not be marked open */
+		{
+			reg->open = FALSE;
+			util_out_print("Region !AD : is already open under another name", TRUE, REG_LEN_STR(reg));
+			continue;
+		}
+		if (reg->read_only)
+		{
+			util_out_print("Region !AD : MUPIP REORG -FREE_DEFERRED cannot run on a read-only database", TRUE,
+				REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		TP_CHANGE_REG(reg);	/* sets gv_cur_region, cs_addrs, cs_data */
+		csa = cs_addrs;
+		csd = cs_data;
+		cnl = csa->nl;
+		subtrees = 0;
+		sleep_counter = 0;
+		while (!mu_ctrly_occurred && !mu_ctrlc_occurred)
+		{
+			grab_crit(reg);
+			if (0 == csd->defer_free_cnt)
+			{
+				rel_crit(reg);
+				break;
+			}
+			if (0 < cnl->inhibit_kills)
+			{	/* An online BACKUP or INTEG wants no kills in progress; give it the same time a KILL would */
+				rel_crit(reg);
+				if (MAXWAIT2KILL <= ++sleep_counter)
+				{
+					cnl->inhibit_kills = 0;
+					SHM_WRITE_MEMORY_BARRIER;
+				} else
+					wcs_sleep(sleep_counter);
+				continue;
+			}
+			sleep_counter = 0;
+			/* An online rollback clears the list, so whatever is in it now was added after that and is safe to free */
+			csa->onln_rlbk_cycle = cnl->onln_rlbk_cycle;
+			cnt = MIN(csd->defer_free_cnt, DEFER_FREE_BATCH);
+			ks_head.next_kill_set = NULL;
+			for (idx = 0; idx < cnt; idx++)
+			{
+				ksb = &ks_head.blk[idx];
+				ksb->block = csd->defer_free_blk[--csd->defer_free_cnt];
+				ksb->level = 1;	/* an index block; gvcst_expand_free_subtree gets the actual level from the block */
+				ksb->flag = 0;
+			}
+			ks_head.used = cnt;
+			GVSTATS_SET_CSA_STATISTIC(csa, n_kill_defer_pend, csd->defer_free_cnt);
+			INCR_KIP(csd, csa, kip_csa);
+			rel_crit(reg);
+			kill_set_tail = &ks_head;	/* gvcst_delete_blk appends the child blocks here */
+			inctn_opcode = inctn_invalid_op;
+			gvcst_expand_free_subtree(&ks_head);
+			DECR_KIP(csd, csa, kip_csa);
+			for (ks = ks_head.next_kill_set; NULL != ks; ks = next_ks)
+			{
+				next_ks = ks->next_kill_set;
+				free(ks);
+			}
+			subtrees += cnt;
+			sleep_nsec = csd->reorg_sleep_nsec;
+			if (sleep_nsec)
+				NANOSLEEP(sleep_nsec, RESTART_TRUE);
+		}
+		util_out_print("Region !AD : Freed the blocks of !UL detached subtree(s)", TRUE, REG_LEN_STR(reg), subtrees);
+	}
+	if (mu_ctrly_occurred || mu_ctrlc_occurred)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_REORGCTRLY);
+		status = ERR_MUNOFINISH;
+	}
+	mupip_exit(status);
+}
@@ -0,0 +1,289 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdio.h"
+#include "gtm_stdlib.h"
+
+#include "cdb_sc.h"
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "jnl.h"
+#include "gdskill.h"
+#include "gdscc.h"
+#include "copy.h"
+#include "muextr.h"
+#include "mu_reorg.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "tp.h"
+#include "repl_msg.h"		/* for gtmsource.h */
+#include "gtmsource.h"		/* for jnlpool_addrs_ptr_t */
+#include "gtm_multi_proc.h"
+
+/* Prototypes */
+#include "gtmmsg.h"		/* for gtm_putmsg prototype */
+#include "gvcst_expand_key.h"
+#include "gvcst_protos.h"	/* for gvcst_search prototype */
+#include "mupip_reorg.h"
+#include "op.h"
+#include "t_abort.h"
+#include "t_begin.h"
+#include "t_end.h"
+#include "t_retry.h"
+#include "util.h"
+
+GBLREF	gd_region		*gv_cur_region;
+GBLREF	gv_key			*gv_currkey;
+GBLREF	gv_namehead		*gv_target;
+GBLREF	int4			gv_keysize;
+GBLREF	inctn_opcode_t		inctn_opcode;
+GBLREF	sgmnt_addrs		*cs_addrs;
+GBLREF	sgmnt_data_ptr_t	cs_data;
+GBLREF	uint4			mu_reorg_blks_per_sec;
+GBLREF	uint4			update_trans;
+
+error_def(ERR_DBRDONLY);
+error_def(ERR_MUNOFINISH);
+error_def(ERR_MUREORGFAIL);
+
+typedef struct
+{
+	glist		*gl_ptr;
+	glist		*exclude_glist_ptr;
+	gv_key		*begin_key;	/* NULL for the first worker, which starts at the first data block of the global */
+	gv_key		*end_key;	/* NULL for the last worker, which continues to the last data block of the global */
+	int		index_fill_factor;
+	int		data_fill_factor;
+	int		reorg_op;
+	uint4		blks_per_sec;
+	unsigned char	key[MAX_MIDENT_LEN + 16];	/* "<global> worker <n>", the prefix of the worker's output lines */
+} reorg_worker_t;
+
+STATICFNDCL int mu_reorg_worker(reorg_worker_t *worker);
+STATICFNDCL int mu_reorg_worker_init(reorg_worker_t *worker);
+STATICFNDCL int mu_reorg_worker_finish(reorg_worker_t *worker);
+STATICFNDCL int mu_reorg_split_keys(mstr *gn, gv_key **split_key, int nworkers);
+
+/* Runs in each process forked off by gtm_multi_proc */
+STATICFNDEF int mu_reorg_worker(reorg_worker_t *worker)
+{
+	boolean_t	resume;
+
+	multi_proc_key = worker->key;
+	mu_reorg_blks_per_sec = worker->blks_per_sec;
+	resume = FALSE;
+	if (!mu_reorg(worker->gl_ptr, worker->exclude_glist_ptr, &resume, worker->index_fill_factor, worker->data_fill_factor,
+			worker->reorg_op, worker->begin_key, worker->end_key))
+		return ERR_MUNOFINISH;
+	return 0;
+}
+
+STATICFNDEF int mu_reorg_worker_init(reorg_worker_t *worker)
+{	/* Nothing to set up in the shared memory; the workers only share the database */
+	return 0;
+}
+
+STATICFNDEF int mu_reorg_worker_finish(reorg_worker_t *worker)
+{
+	if (multi_proc_in_use)
+	{
+		multi_proc_key = NULL;	/* reset key now that parallel invocations are done */
+		DEBUG_ONLY(multi_proc_key_exception = TRUE;)	/* "multi_proc_in_use" stays TRUE until we return to
+								 * "gtm_multi_proc", so avoid asserts until then.
+								 */
+	}
+	return 0;
+}
+
+/* Picks up to nworkers - 1 keys from the records of the root block of the global named gn, evenly spaced by record count,
+ * such that each delimits a key range of about the same number of subtrees. An index record holds the last key of the
+ * subtree it points to, so the range of worker i ends with split_key[i] and the range of worker i + 1 starts after it.
+ * Returns the number of key ranges, which is 1 if the root is a data block or has too few records to split.
+ */
+STATICFNDEF int mu_reorg_split_keys(mstr *gn, gv_key **split_key, int nworkers)
+{
+	blk_hdr_ptr_t		bp;
+	enum cdb_sc		status;
+	int			idx, nranges, nrecs, rec_idx;
+	int4			rec_offset;
+	rec_hdr_ptr_t		rp, rtop;
+	srch_blk_status		*root;
+	unsigned short		temp_ushort;
+
+	t_begin(ERR_MUREORGFAIL, 0);
+	for (; ;)
+	{
+		gv_target->clue.end = 0;
+		memcpy(&gv_currkey->base[0], gn->addr, gn->len);
+		gv_currkey->base[gn->len] = gv_currkey->base[gn->len + 1] = 0;
+		gv_currkey->end = gn->len + 1;
+		if (cdb_sc_normal != (status = gvcst_search(gv_currkey, NULL)))
+		{
+			t_retry(status);
+			continue;
+		}
+		nranges = 1;
+		if (0 < gv_target->hist.depth)
+		{
+			root = &gv_target->hist.h[gv_target->hist.depth];
+			bp = (blk_hdr_ptr_t)root->buffaddr;
+			rp = (rec_hdr_ptr_t)((sm_uc_ptr_t)bp + SIZEOF(blk_hdr));
+			rtop = (rec_hdr_ptr_t)((sm_uc_ptr_t)bp + MIN(bp->bsiz, cs_data->blk_size));
+			for (nrecs = 0; rp < rtop; nrecs++)
+			{
+				GET_USHORT(temp_ushort, &rp->rsiz);
+				if (BSTAR_REC_SIZE > temp_ushort)
+					break;
+				rp = (rec_hdr_ptr_t)((sm_uc_ptr_t)rp + temp_ushort);
+			}
+			if (rp != rtop)
+			{
+				t_retry(cdb_sc_rmisalign);
+				continue;
+			}
+			nrecs--;	/* the star record has no key */
+			nranges = MIN(nworkers, nrecs + 1);
+			for (idx = 1; idx < nranges; idx++)
+			{	/* find the offset of record number rec_idx and expand its key */
+				rec_idx = ((idx * (nrecs + 1)) / nranges) - 1;
+				rp = (rec_hdr_ptr_t)((sm_uc_ptr_t)bp + SIZEOF(blk_hdr));
+				while (rec_idx--)
+				{
+					GET_USHORT(temp_ushort, &rp->rsiz);
+					rp = (rec_hdr_ptr_t)((sm_uc_ptr_t)rp + temp_ushort);
+				}
+				rec_offset = (int4)((sm_uc_ptr_t)rp - (sm_uc_ptr_t)bp);
+				if (cdb_sc_normal != (status = gvcst_expand_key(root, rec_offset, split_key[idx - 1])))
+					break;
+			}
+			if (idx < nranges)
+			{
+				t_retry(status);
+				continue;
+			}
+		}
+		/* Validate what we read; update_trans is 0 so t_end commits nothing */
+		assert(0 == update_trans);
+		if ((trans_num)0 == t_end(&gv_target->hist, NULL, TN_NOT_SPECIFIED))
+			continue;
+		break;
+	}
+	return nranges;
+}
+
+/* MUPIP REORG -PARALLEL=n
+ *
+ * Reorganizes one global with up to n processes. The global is split into key ranges at keys taken from its root block
+ * (see mu_reorg_split_keys) and a process forked off by gtm_multi_proc splits and coalesces the data and index blocks of
+ * each range at the same time as the others (mu_reorg with a key range). Updates, including those of the other workers,
+ * are checked by the usual t_end validation so the workers need no coordination; blocks on the boundary of two ranges may
+ * just be looked at twice. Each worker reports its progress every REORG_PROGRESS_SECS seconds and is held to its share of
+ * the -RATE. Swapping blocks into key order and reducing levels need the whole global, so once all workers are done, this
+ * process makes one more pass over the global for those (skipping split and coalesce), as MUPIP REORG without -PARALLEL
+ * would.
+ */
+boolean_t mu_reorg_parallel(glist *gl_ptr, glist *exclude_glist_ptr, int index_fill_factor, int data_fill_factor,
+			int reorg_op, int nworkers)
+{
+	boolean_t		resume;
+	gv_key			*begin_key, **split_key;
+	int			idx, nranges, status;
+	mstr			*gn;
+	reorg_worker_t		*workers;
+	uint4			blks_per_sec;
+	void			**ret_array;
+
+	assert(1 < nworkers);
+	inctn_opcode = inctn_invalid_op; /* temporary reset; satisfy an assert in t_end() */
+	DO_OP_GVNAME(gl_ptr);
+		/* sets gv_target/gv_currkey/gv_cur_region/cs_addrs/cs_data to correspond to <globalname,reg> in gl_ptr */
+	if (gv_cur_region->read_only)
+	{
+		gtm_putmsg_csa(CSA_ARG(cs_addrs) VARLSTCNT(4) ERR_DBRDONLY, 2, DB_LEN_STR(gv_cur_region));
+		return FALSE;
+	}
+	if (0 == gv_target->root)
+		return TRUE; /* It is not an error that global was killed */
+	gn = &GNAME(gl_ptr);
+	split_key = (gv_key **)malloc(SIZEOF(gv_key *) * (nworkers - 1));
+	for (idx = 0; idx < nworkers - 1; idx++)
+	{
+		split_key[idx] = (gv_key *)malloc(SIZEOF(gv_key) + gv_keysize);
+		split_key[idx]->top = gv_keysize;
+	}
+	nranges = mu_reorg_split_keys(gn, split_key, nworkers);
+	t_abort(gv_cur_region, cs_addrs);	/* do crit and other cleanup */
+	status = 0;
+	if (1 < nranges)
+	{
+		util_out_print("Splitting and coalescing with !UL worker processes", FLUSH, nranges);
+		workers = (reorg_worker_t *)malloc(SIZEOF(reorg_worker_t) * nranges);
+		ret_array = (void **)malloc(SIZEOF(void *) * nranges);
+		blks_per_sec = mu_reorg_blks_per_sec ? MAX(mu_reorg_blks_per_sec / nranges, 1) : 0;
+		for (idx = 0; idx < nranges; idx++)
+		{
+			workers[idx].gl_ptr = gl_ptr;
+			workers[idx].exclude_glist_ptr = exclude_glist_ptr;
+			workers[idx].end_key = (idx < (nranges - 1)) ? split_key[idx] : NULL;
+			workers[idx].begin_key = NULL;
+			if (idx)
+			{	/* Start from the smallest key greater than the end key of the previous range, which is in the first
+				 * data block of this one. Replacing the terminating byte of that key with 0x01 makes it.
+				 */
+				begin_key = (gv_key *)malloc(SIZEOF(gv_key) + gv_keysize);
+				memcpy(begin_key, split_key[idx - 1], SIZEOF(gv_key) + split_key[idx - 1]->end);
+				if ((begin_key->end + 2) < begin_key->top)
+				{
+					begin_key->base[begin_key->end] = 1;
+					begin_key->base[begin_key->end + 1] = 0;
+					begin_key->base[begin_key->end + 2] = 0;
+					begin_key->end += 2;
+				}
+				workers[idx].begin_key = begin_key;
+			}
+			workers[idx].index_fill_factor = index_fill_factor;
+			workers[idx].data_fill_factor = data_fill_factor;
+			workers[idx].reorg_op = reorg_op | NOSWAP;
+			workers[idx].blks_per_sec = blks_per_sec;
+			SNPRINTF((char *)workers[idx].key, SIZEOF(workers[idx].key), "%.*s worker %d", gn->len, gn->addr, idx + 1);
+		}
+		status = gtm_multi_proc((gtm_multi_proc_fnptr_t)&mu_reorg_worker, nranges, nranges, ret_array, (void *)workers,
+					SIZEOF(reorg_worker_t), 0, (gtm_multi_proc_fnptr_t)&mu_reorg_worker_init,
+					(gtm_multi_proc_fnptr_t)&mu_reorg_worker_finish);
+		for (idx = 0; idx < nranges; idx++)
+		{
+			if (!status && ret_array[idx])
+				status = (int)(INTPTR_T)ret_array[idx];
+			if (NULL != workers[idx].begin_key)
+				free(workers[idx].begin_key);
+		}
+		free(ret_array);
+		free(workers);
+		util_out_print("Swapping blocks and reducing levels", FLUSH);
+	}
+	for (idx = 0; idx < nworkers - 1; idx++)
+		free(split_key[idx]);
+	free(split_key);
+	if (status)
+		return FALSE;
+	resume = FALSE;
+	return mu_reorg(gl_ptr, exclude_glist_ptr, &resume, index_fill_factor, data_fill_factor,
+			reorg_op | ((1 < nranges) ? (NOSPLIT | NOCOALESCE) : 0), NULL, NULL);
+}
@@ -681,7 +681,8 @@ void mupip_integ(void)
 				else
 					gtm_putmsg_csa(CSA_ARG(csa) VARLSTCNT(1) ERR_DBBTUFIXED);
 			}
-			if (((0 != mu_int_data.kill_in_prog) || (0 != mu_int_data.abandoned_kills)) && (!mu_map_errs) && !region
+			if (((0 != mu_int_data.kill_in_prog) || (0 != mu_int_data.abandoned_kills)
+					|| (0 != mu_int_data.defer_free_cnt)) && (!mu_map_errs) && !region
 				&& !gv_cur_region->read_only)
 			{
 				assert(mu_int_errknt > 0);
@@ -59,6 +59,8 @@
 /* Prototypes */
 #include "mupip_reorg.h"
 #include "mu_reorg_upgrd_dwngrd.h"
+#include "mu_reorg_free_deferred.h"
+#include "mu_reorg_compact.h"
 #include "targ_alloc.h"
 #include "mupip_exit.h"
 #include "gv_select.h"
@@ -95,6 +97,7 @@ GBLREF	int			gv_keysize;
 GBLREF	sgmnt_addrs		*cs_addrs;
 GBLREF	sgmnt_data_ptr_t	cs_data;
 GBLREF	tp_region		*grlist;
+GBLREF	uint4			mu_reorg_blks_per_sec;
 GBLREF	uint4			process_id;
 
 static readonly mval literal_poollimit =
@@ -103,7 +106,7 @@ static readonly mval literal_poollimit =
 void mupip_reorg(void)
 {
 	boolean_t		resume, reorg_success = TRUE;
-	int			data_fill_factor, index_fill_factor;
+	int			data_fill_factor, index_fill_factor, nworkers;
 	int			reorg_op, reg_max_rec, reg_max_key, reg_max_blk, status;
 	char			cli_buff[MAX_LINE], *ptr;
 	glist			gl_head, exclude_gl_head, *gl_ptr, hasht_gl;
@@ -141,6 +144,16 @@ void mupip_reorg(void)
 		 */
 		mupip_reorg_encrypt();
 		mupip_exit(SS_NORMAL);	/* does not return */
+	} else if (CLI_PRESENT == cli_present("FREE_DEFERRED"))
+	{	/* Note that "mu_reorg_process" is not set to TRUE in case of MUPIP REORG -FREE_DEFERRED.
+		 * This is intentional because we are not doing any REORG kind of processing.
+		 */
+		mu_reorg_free_deferred();
+		mupip_exit(SS_NORMAL);	/* does not return */
+	} else if (CLI_PRESENT == cli_present("COMPACT"))
+	{	/* Note that "mu_reorg_process" is set to TRUE by mu_reorg_compact only while it moves blocks */
+		mu_reorg_compact();
+		mupip_exit(SS_NORMAL);	/* does not return */
 	}
 	grlist = NULL;
 	restrict_reg = FALSE;
@@ -164,6 +177,22 @@ void mupip_reorg(void)
 	}
 
 	resume = (CLI_PRESENT == cli_present("RESUME"));
+	nworkers = 1;
+	if (CLI_PRESENT == cli_present("PARALLEL"))
+	{
+		if (!cli_get_int("PARALLEL", (int4 *)&nworkers) || (1 > nworkers) || (MAX_REORG_WORKERS < nworkers))
+		{
+			util_out_print("PARALLEL must be between 1 and !UL", FLUSH, MAX_REORG_WORKERS);
+			mupip_exit(ERR_MUPCLIERR);
+		}
+		if (resume && (1 < nworkers))
+		{
+			util_out_print("MUPIP REORG -RESUME cannot be combined with -PARALLEL", FLUSH);
+			mupip_exit(ERR_MUPCLIERR);
+		}
+	}
+	if ((CLI_PRESENT == cli_present("RATE")) && !cli_get_int("RATE", (int4 *)&mu_reorg_blks_per_sec))
+		mupip_exit(ERR_MUPCLIERR);
 	reorg_op = DEFAULT;
 	n_len = SIZEOF(cli_buff);
 	memset(cli_buff, 0, n_len);
@@ -281,7 +310,12 @@ void mupip_reorg(void)
 		 */
 		reorg_gv_target->gvname.var_name = GNAME(gl_ptr);
 		GTMTRIG_ONLY(assert(!IS_MNAME_HASHT_GBLNAME(reorg_gv_target->gvname.var_name));)
-		cur_success = mu_reorg(gl_ptr, &exclude_gl_head, &resume, index_fill_factor, data_fill_factor, reorg_op);
+		if (1 < nworkers)
+			cur_success = mu_reorg_parallel(gl_ptr, &exclude_gl_head, index_fill_factor, data_fill_factor, reorg_op,
+							nworkers);
+		else
+			cur_success = mu_reorg(gl_ptr, &exclude_gl_head, &resume, index_fill_factor, data_fill_factor, reorg_op,
+						NULL, NULL);
 		reorg_success &= cur_success;
 		SET_GV_CURRKEY_FROM_GVT(reorg_gv_target);
 		if (truncate)
@@ -321,7 +355,8 @@ void mupip_reorg(void)
 								REG_LEN_STR(gv_cur_region));
 							reorg_gv_target->gvname.var_name = gv_target->gvname.var_name;
 							cur_success = mu_reorg(&hasht_gl, &exclude_gl_head, &resume,
-										index_fill_factor, data_fill_factor, reorg_op);
+										index_fill_factor, data_fill_factor, reorg_op,
+										NULL, NULL);
 							reorg_success &= cur_success;
 						}
 					}
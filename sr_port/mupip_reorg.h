@@ -15,8 +15,13 @@
 /* prototypes */
 
 boolean_t mu_reorg(glist *gl_ptr, glist *exclude_glist_ptr, boolean_t *resume,
-			int index_fill_factor, int data_fill_factor, int reorg_op);
+			int index_fill_factor, int data_fill_factor, int reorg_op, gv_key *begin_key, gv_key *end_key);
+boolean_t mu_reorg_parallel(glist *gl_ptr, glist *exclude_glist_ptr, int index_fill_factor, int data_fill_factor,
+			int reorg_op, int nworkers);
 # ifdef UNIX
+#define RETRY_SWAP		(0)	/* returned by swap_root_or_directory_block in place of a block number */
+#define ABORT_SWAP		(1)
+
 void	 mu_swap_root(glist *gl_ptr, int *root_swap_statistic_ptr);
 block_id swap_root_or_directory_block(int parent_blk_lvl, int level, srch_hist *dir_hist_ptr, block_id child_blk_id,
 		sm_uc_ptr_t child_blk_ptr, kill_set *kill_set_list, trans_num curr_tn);
@@ -30,5 +35,7 @@ enum cdb_sc gvcst_expand_any_key (srch_blk_status *blk_stat, sm_uc_ptr_t rec_top
 boolean_t in_exclude_list(unsigned char *curr_key_ptr, int key_len, glist *exclude_glist_ptr);
 void mupip_reorg(void);
 
+#define	MAX_REORG_WORKERS	64	/* most worker processes MUPIP REORG -PARALLEL forks off per global */
+
 #define  MUPIP_REORG_DEFINED
 #endif
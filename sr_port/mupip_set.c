@@ -84,6 +84,7 @@ void mupip_set(void)
 	if ((CLI_PRESENT == cli_present("ACCESS_METHOD"))
 		|| (CLI_PRESENT == cli_present("ASYNCIO"))
 		|| (CLI_NEGATED == cli_present("ASYNCIO"))
+		|| (CLI_PRESENT == cli_present("CLUSTER_BLOCKS"))
 		|| (CLI_NEGATED == cli_present("DEFER_ALLOCATE"))
 		|| (CLI_PRESENT == cli_present("DEFER_ALLOCATE"))
 		|| (CLI_PRESENT == cli_present("DEFER_TIME"))
@@ -92,10 +93,12 @@ void mupip_set(void)
 		|| (CLI_PRESENT == cli_present("ENCRYPTIONCOMPLETE"))
 		|| (CLI_NEGATED == cli_present("EPOCHTAPER"))
 		|| (CLI_PRESENT == cli_present("EPOCHTAPER"))
+		|| (CLI_PRESENT == cli_present("EXTEND_AHEAD"))
 		|| (CLI_PRESENT == cli_present("EXTENSION_COUNT"))
 		|| (CLI_PRESENT == cli_present("FLUSH_TIME"))
 		|| (CLI_PRESENT == cli_present("GLOBAL_BUFFERS"))
 		|| (CLI_PRESENT == cli_present("HARD_SPIN_COUNT"))
+		|| (CLI_PRESENT == cli_present("HUGE_PAGES"))
 		|| (CLI_NEGATED == cli_present("INST_FREEZE_ON_ERROR"))
 		|| (CLI_PRESENT == cli_present("INST_FREEZE_ON_ERROR"))
 		|| (CLI_PRESENT == cli_present("KEY_SIZE"))
@@ -104,6 +107,8 @@ void mupip_set(void)
 		|| (CLI_PRESENT == cli_present("LOCK_SPACE"))
 		|| (CLI_PRESENT == cli_present("MUTEX_SLOTS"))
 		|| (CLI_PRESENT == cli_present("NULL_SUBSCRIPTS"))
+		|| (CLI_PRESENT == cli_present("NUMA_INTERLEAVE"))
+		|| (CLI_NEGATED == cli_present("NUMA_INTERLEAVE"))
 		|| (CLI_PRESENT == cli_present("PARTIAL_RECOV_BYPASS"))
 		|| (CLI_NEGATED == cli_present("QDBRUNDOWN"))
 		|| (CLI_PRESENT == cli_present("QDBRUNDOWN"))
@@ -112,6 +117,8 @@ void mupip_set(void)
 		|| (CLI_PRESENT == cli_present("RECORD_SIZE"))
 		|| (CLI_PRESENT == cli_present("REORG_SLEEP_NSEC"))
 		|| (CLI_PRESENT == cli_present("RESERVED_BYTES"))
+		|| (CLI_PRESENT == cli_present("SCAN_RESISTANT"))
+		|| (CLI_NEGATED == cli_present("SCAN_RESISTANT"))
 		|| (CLI_PRESENT == cli_present("SLEEP_SPIN_COUNT"))
 		|| (CLI_PRESENT == cli_present("SPIN_SLEEP_MASK"))
 		|| (CLI_NEGATED == cli_present("STATS"))
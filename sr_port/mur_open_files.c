@@ -710,6 +710,16 @@ uint4 mur_open_files(boolean_t retry)
 					assert(!csa->nl->donotflush_dbjnl || jgbl.onlnrlbk);
 					csa->nl->donotflush_dbjnl = TRUE; /* indicate gds_rundown/mu_rndwn_file to not wcs_flu()
 									   * this shared memory until recover/rlbk cleanly exits */
+					if (!mur_options.forward && csd->defer_free_cnt)
+					{	/* Backward processing can restore the before images of the blocks whose update
+						 * detached the subtrees in the deferred free list, making those subtrees reachable
+						 * again, so MUPIP REORG -FREE_DEFERRED must not free them. Drop the list. The
+						 * subtrees that stay detached are left incorrectly marked busy, same as for an
+						 * abandoned KILL, so count it as one.
+						 */
+						csd->defer_free_cnt = 0;
+						csd->abandoned_kills++;
+					}
 				}
 				assert(!JNL_ENABLED(csd) || 0 == csd->jnl_file_name[csd->jnl_file_len]);
 				rctl->db_ctl->file_info = FILE_CNTL(rctl->gd)->file_info;
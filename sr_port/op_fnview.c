@@ -58,8 +58,10 @@
 #include "gvn2gds.h"
 #include "io.h"
 #include "interlock.h"
+#include "db_snapshot.h"
 #include "cache.h"
 #include "hashtab_objcode.h"
+#include "gtm_malloc.h"
 
 GBLREF spdesc			stringpool;
 GBLREF int4			cache_hits, cache_fails;
@@ -89,6 +91,8 @@ GBLREF int4			gtm_trigger_depth;
 GBLREF uint4			process_id;
 GBLREF boolean_t		dmterm_default;
 GBLREF mstr			extnam_str;
+GBLREF storStats_t		storStats;
+GBLREF linkStats_t		linkStats;
 
 error_def(ERR_COLLATIONUNDEF);
 error_def(ERR_GBLNOMAPTOREG);
@@ -137,6 +141,7 @@ void	op_fnview(int numarg, mval *dst, ...)
 	gv_key		*gvkey;
 	gv_key		save_currkey[DBKEYALLOC(MAX_KEY_SZ)];
 	gv_namehead	temp_gv_target;
+	gvstats_rec_t	gvstats_rec;
 	gvnh_reg_t	*gvnh_reg;
 	gvnh_spanreg_t	*gvspan;
 	int		n, tl, newlevel, res, reg_index, collver, nct, act, ver, trigdepth, cidepth;
@@ -222,6 +227,28 @@ void	op_fnview(int numarg, mval *dst, ...)
 			MV_FORCE_STR(arg2);
 			s2pool_concat(dst, &arg2->str);
 			break;
+		case VTK_STORSTATS:
+			ENSURE_STP_FREE_SPACE(6 * (STATS_MAX_DIGITS + STATS_KEYWD_SIZE));
+			dst->str.addr = (char *)stringpool.free;
+			STATS_PUT_PARM("EXA", extAlloc, storStats);
+			STATS_PUT_PARM("EXF", extFree, storStats);
+			STATS_PUT_PARM("BGA", bigAlloc, storStats);
+			STATS_PUT_PARM("BGF", bigFree, storStats);
+			STATS_PUT_PARM("TRC", trimCnt, storStats);
+			STATS_PUT_PARM("TRP", trimPend, storStats);
+			stringpool.free--;		/* subtract one to remove extra trailing delimiter */
+			dst->str.len = INTCAST((char *)stringpool.free - dst->str.addr);
+			break;
+		case VTK_RTNSTATS:
+			ENSURE_STP_FREE_SPACE(4 * (STATS_MAX_DIGITS + STATS_KEYWD_SIZE));
+			dst->str.addr = (char *)stringpool.free;
+			STATS_PUT_PARM("MPC", mapCnt, linkStats);
+			STATS_PUT_PARM("MPB", mapBytes, linkStats);
+			STATS_PUT_PARM("RDC", readCnt, linkStats);
+			STATS_PUT_PARM("RDB", readBytes, linkStats);
+			stringpool.free--;		/* subtract one to remove extra trailing delimiter */
+			dst->str.len = INTCAST((char *)stringpool.free - dst->str.addr);
+			break;
 		case VTK_GDSCERT:
 			if (certify_all_blocks)
 				*dst = literal_one;
@@ -390,6 +417,13 @@ void	op_fnview(int numarg, mval *dst, ...)
 					VARLSTCNT(4) ERR_VIEWFN, 2, strlen((const char *)vtp->keyword), vtp->keyword);
 			n = parmblk.ni_list.gvnh_list->gvnh->noisolation;
 			break;
+		case VTK_GBLFILLFACTOR:
+			if (NOISOLATION_NULL != parmblk.ni_list.type || NULL == parmblk.ni_list.gvnh_list
+			    || NULL != parmblk.ni_list.gvnh_list->next)
+				rts_error_csa(CSA_ARG(NULL)
+					VARLSTCNT(4) ERR_VIEWFN, 2, strlen((const char *)vtp->keyword), vtp->keyword);
+			n = GVT_FILLFACTOR(parmblk.ni_list.gvnh_list->gvnh);	/* the fill factor that is in effect */
+			break;
 		case VTK_PATCODE:
 			getpattabnam(&tmpstr);
 			s2pool(&tmpstr);
@@ -403,6 +437,12 @@ void	op_fnview(int numarg, mval *dst, ...)
 			csa = &FILE_INFO(reg)->s_addrs;
 			n = csa->gbuff_limit;
 			break;
+		case VTK_SNAPSHOT:
+			assert(NULL != gd_header);	/* view_arg_convert would have done this for VTK_SNAPSHOT */
+			reg = parmblk.gv_ptr;
+			csa = (reg->open && IS_REG_BG_OR_MM(reg)) ? &FILE_INFO(reg)->s_addrs : NULL;
+			ui82mval(dst, ((NULL != csa) && (NULL != csa->ss_read)) ? csa->ss_read->snapshot_tn : 0);
+			return;		/* the snapshot transaction number need not fit in "n" */
 #ifdef TESTPOLLCRIT
 		case VTK_GRABCRIT:
 		case VTK_RELCRIT:
@@ -473,8 +513,9 @@ void	op_fnview(int numarg, mval *dst, ...)
 				dst->str.len = 0;
 				ENSURE_STP_FREE_SPACE(n_probecrit_rec_types * (STATS_MAX_DIGITS + STATS_KEYWD_SIZE));
 				dst->str.addr = (char *)stringpool.free;
-				/* initialize csa->proberit_rec.p_crit_success field from cnl->gvstats_rec */
-				csa->probecrit_rec.p_crit_success = csa->nl->gvstats_rec.n_crit_success;
+				/* initialize csa->proberit_rec.p_crit_success field from the database statistics */
+				gvstats_rec_cnl_sum(csa->nl, &gvstats_rec);
+				csa->probecrit_rec.p_crit_success = gvstats_rec.n_crit_success;
 #				define TAB_PROBECRIT_REC(CNTR,TEXT1,TEXT2)	STATS_PUT_PARM(TEXT1, CNTR, csa->probecrit_rec)
 #				include "tab_probecrit_rec.h"
 #				undef TAB_PROBECRIT_REC
@@ -588,9 +629,12 @@ void	op_fnview(int numarg, mval *dst, ...)
 			{
 				ENSURE_STP_FREE_SPACE(n_gvstats_rec_types * (STATS_MAX_DIGITS + STATS_KEYWD_SIZE) + 1);
 				dst->str.addr = (char *)stringpool.free;
-				/* initialize cnl->gvstats_rec.db_curr_tn field from file header */
-				csa->nl->gvstats_rec.db_curr_tn = csa->hdr->trans_hist.curr_tn;
-#				define TAB_GVSTATS_REC(CNTR,TEXT1,TEXT2)	STATS_PUT_PARM(TEXT1, CNTR, csa->nl->gvstats_rec)
+				/* initialize cnl->gvstats_base.db_curr_tn field from file header */
+				csa->nl->gvstats_base.db_curr_tn = csa->hdr->trans_hist.curr_tn;
+				gvstats_rec_cnl_sum(csa->nl, &gvstats_rec);
+				/* KDP is the current length of the deferred free list, not a count accumulated in the shards */
+				gvstats_rec.n_kill_defer_pend = csa->hdr->defer_free_cnt;
+#				define TAB_GVSTATS_REC(CNTR,TEXT1,TEXT2)	STATS_PUT_PARM(TEXT1, CNTR, gvstats_rec)
 #				include "tab_gvstats_rec.h"
 #				undef TAB_GVSTATS_REC
 				assert(stringpool.free < stringpool.top);
@@ -146,6 +146,7 @@ int	op_lock2(mval *timeout, unsigned char laflag)	/* timeout is in seconds */
 	signed char		gotit;
 	unsigned short		locks_bckout, locks_done;
 	int4			msec_timeout;	/* timeout in milliseconds */
+	uint4			sleep_msec;	/* length of the next sleep while blocked */
 	mlk_pvtblk		*pvt_ptr1, *pvt_ptr2, **prior, *already_locked;
 	unsigned char		action;
 	ABS_TIME		cur_time, end_time, remain_time;
@@ -291,6 +292,13 @@ int	op_lock2(mval *timeout, unsigned char laflag)	/* timeout is in seconds */
 			assert(have_crit(CRIT_HAVE_ANY_REG));
 			tp_warning(pvt_ptr2);
 		}
+		/* A wakeup from the lock holder (SIGALRM via mlk_wake_pending) that arrives before we start sleeping is lost, and
+		 * then we would sleep a full LOCK_SELF_WAKE even if the lock was released right away. So start with a short sleep
+		 * and double it each time the blocking lock is seen unchanged, checking the sequence number (which needs no crit)
+		 * in between. The time it takes to notice a release then tracks how long the lock has been held. If there is no
+		 * "blocked" shrblk (lock space full), every wakeup reattempts the lock in crit, so stay with LOCK_SELF_WAKE then.
+		 */
+		sleep_msec = (NULL != pvt_ptr1->blocked) ? LOCK_SELF_WAKE_MIN : LOCK_SELF_WAKE;
 		for (;;)
 		{
 			if (out_of_time || outofband)
@@ -353,7 +361,7 @@ int	op_lock2(mval *timeout, unsigned char laflag)	/* timeout is in seconds */
 			 * in mlk_shrblk_find. If mlk_lock is invoked for the second (or higher) time in op_lock2 for the
 			 * same lock resource, "mlk_shrblk_find" assumes a sleep has happened in between two locking attempts.
 			 */
-			hiber_start_wait_any(LOCK_SELF_WAKE);
+			hiber_start_wait_any(sleep_msec);
 			/* Every reattempt at a blocking lock needs crit which could be a bottleneck. So minimize reattempts.
 			 * The "blk_sequence" check below serves that purpose. If the sequence number is different between
 			 * the shared and private copies, it means the lock state in shared memory has changed since last we
@@ -370,6 +378,7 @@ int	op_lock2(mval *timeout, unsigned char laflag)	/* timeout is in seconds */
 			{
 				if (pvt_ptr1->pvtctl.ctl->lock_gc_in_progress.u.parts.latch_pid == process_id)
 					pvt_ptr1->pvtctl.ctl->lock_gc_in_progress.u.parts.latch_pid = 0;
+				sleep_msec = MIN(sleep_msec * 2, LOCK_SELF_WAKE);
 				continue;
 			}
 			/* Note that "TREF(mlk_yield_pid)" is not initialized here as we want to use any value inherited
@@ -391,6 +400,7 @@ int	op_lock2(mval *timeout, unsigned char laflag)	/* timeout is in seconds */
 			}
 			if (pvt_ptr1->nodptr)
 				mlk_check_own(pvt_ptr1);		/* clear an abandoned owner */
+			sleep_msec = (NULL != pvt_ptr1->blocked) ? LOCK_SELF_WAKE_MIN : LOCK_SELF_WAKE;
 		}
 		if (blocked && out_of_time)
 			break;
@@ -383,6 +383,8 @@ enum cdb_sc	op_tcommit(void)
 							 * maximize chances that the blocks we assign remain available in tp_tend
 							 */
 							cse->blk = ++csa->tp_hint;
+							if (csd->alloc_cluster)
+								cse->blk = bm_cluster_hint(cse->blk_target, cse->blk);
 							while (FILE_EXTENDED == (new_blk = bm_getfree(cse->blk, &blk_used,
 								cw_depth, first_cse, &si->cw_set_depth)))
 							{
@@ -400,9 +402,11 @@ enum cdb_sc	op_tcommit(void)
 							{
 								GET_CDB_SC_CODE(new_blk, status); /* code is set in status */
 								break;	/* transaction must attempt restart */
-							} else
-								blk_used ? BIT_CLEAR_FREE(cse->blk_prior_state)
-									 : BIT_SET_FREE(cse->blk_prior_state);
+							}
+							blk_used ? BIT_CLEAR_FREE(cse->blk_prior_state)
+								 : BIT_SET_FREE(cse->blk_prior_state);
+							if (csd->alloc_cluster)
+								bm_cluster_note(cse->blk_target, new_blk);
 							BEFORE_IMAGE_NEEDED(read_before_image, cse, csa, csd, new_blk,
 										before_image_needed);
 							if (!before_image_needed)
@@ -84,6 +84,7 @@
 #include "is_file_identical.h"	/* Needed for JNLPOOL_INIT_IF_NEEDED */
 #include "break.h"
 #include "min_max.h"
+#include "db_snapshot.h"
 
 STATICFNDCL void lvmon_release(void);
 STATICFNDCL void view_dbop(unsigned char keycode, viewparm *parmblkptr, mval *thirdarg);
@@ -263,7 +264,9 @@ void	op_view(int numarg, mval *keyword, ...)
 		case VTK_FLUSH:
 		case VTK_GVSRESET:
 		case VTK_JNLFLUSH:
+		case VTK_NOSNAPSHOT:
 		case VTK_POOLLIMIT:
+		case VTK_SNAPSHOT:
 			view_dbop(vtp->keycode, &parmblk, (numarg > 1) ? va_arg(var, mval *) : (mval *)NULL);
 			break;
 		case VTK_DMTERM:
@@ -371,6 +374,23 @@ void	op_view(int numarg, mval *keyword, ...)
 					SET_GVNH_NOISOLATION_STATUS(gvnh_entry->gvnh, FALSE);
 			}
 			break;
+		case VTK_GBLFILLFACTOR:
+			/* VIEW "GBLFILLFACTOR":"[+]^A,^B":n sets the fill factor of the listed globals to n (or to the process
+			 * wide VIEW "FILL_FACTOR" if n is not specified). VIEW "GBLFILLFACTOR":"-^A,^B" does the latter too.
+			 */
+			if ((1 < numarg) && (NOISOLATION_MINUS != parmblk.ni_list.type))
+			{
+				arg2 = va_arg(var, mval *);
+				testvalue = MV_FORCE_INT(arg2);
+				if (MAX_FILLFACTOR < testvalue)
+					testvalue = MAX_FILLFACTOR;
+				else if (MIN_FILLFACTOR > testvalue)
+					testvalue = MIN_FILLFACTOR;
+			} else
+				testvalue = 0;
+			for (gvnh_entry = parmblk.ni_list.gvnh_list; gvnh_entry; gvnh_entry = gvnh_entry->next)
+				gvnh_entry->gvnh->fill_factor = (unsigned char)testvalue;
+			break;
 		case VTK_PATCODE:
 			if (arg)
 				tmpstr = parmblk.value->str;
@@ -1126,6 +1146,17 @@ STATICFNDEF void view_dbop(unsigned char keycode, viewparm *parmblkptr, mval *th
 					gvcst_remove_statsDB_linkage(reg);
 				}
 				break;
+			case VTK_SNAPSHOT:
+				if (!reg->read_only)	/* else ss_snapshot_read_begin reports the error */
+				{	/* starting the snapshot flushes the region and writes an epoch */
+					JNLPOOL_INIT_IF_NEEDED(cs_addrs, cs_data, cs_addrs->nl, SCNDDBNOUPD_CHECK_FALSE);
+					ENSURE_JNL_OPEN(cs_addrs, gv_cur_region);
+				}
+				ss_snapshot_read_begin();
+				break;
+			case VTK_NOSNAPSHOT:
+				ss_snapshot_read_end();
+				break;
 		}
 	}
 	gv_cur_region = save_reg;
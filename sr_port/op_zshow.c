@@ -45,6 +45,7 @@ void op_zshow(mval *func, int type, lv_val *lvn)
 			done_c = FALSE,
 			done_d = FALSE,
 			done_g = FALSE,
+			done_h = FALSE,
 			done_i = FALSE,
 			done_l = FALSE,
 			done_r = FALSE,
@@ -72,6 +73,8 @@ void op_zshow(mval *func, int type, lv_val *lvn)
 			case 'd':
 			case 'G':
 			case 'g':
+			case 'H':
+			case 'h':
 			case 'I':
 			case 'i':
 			case 'L':
@@ -161,6 +164,14 @@ void op_zshow(mval *func, int type, lv_val *lvn)
 				output.line_num = 0;	/* G statistics start at 0 for <*,*> output and not 1 like the others */
 				zshow_gvstats(&output, FALSE);
 				break;
+			case 'H':
+			case 'h':
+				if (done_h)
+					break;
+				done_h = TRUE;
+				output.code = 'H';
+				zshow_gvstats_lat(&output);
+				break;
 			case 'I':
 			case 'i':
 				if (done_i)
@@ -36,6 +36,8 @@
 #include "gtmimagename.h"
 #include "t_abort.h"
 #include "dpgbldir.h"
+#include "mlkdef.h"
+#include "mlk_wake_pending.h"
 #include "io.h"
 
 GBLREF	gv_namehead		*reset_gv_target;
@@ -60,6 +62,7 @@ void preemptive_db_clnup(int preemptive_severe)
 	 */
 	RESET_BML_SAVE_DOLLAR_TLEVEL;
 	t_abort_cleanup();
+	mlk_wake_defer_send();	/* Send M lock wakeups deferred by a LOCK/ZALLOCATE/unlock that this error interrupted */
 	if ((INVALID_GV_TARGET != reset_gv_target) && (SUCCESS != preemptive_severe && INFO != preemptive_severe))
 	{	/* We know of a few cases in Unix where gv_target and gv_currkey could be out of sync at this point.
 		 *   a) If we are inside trigger code which in turn does an update that does
@@ -93,6 +93,7 @@ void process_gvt_pending_list(gd_region *reg, sgmnt_addrs *csa)
 				assert(IS_REG_BG_OR_MM(reg));
 				new_gvt = (gv_namehead *)targ_alloc(db_max_key_size, &old_gvt->gvname, reg);
 				new_gvt->noisolation = old_gvt->noisolation;	/* Copy over noisolation status from old_gvt */
+				new_gvt->fill_factor = old_gvt->fill_factor;
 				new_gvt->act = old_gvt->act; /* copy over act,nct,ver from old_gvt (actually from the gld file) */
 				new_gvt->nct = old_gvt->nct;
 				new_gvt->ver = old_gvt->ver;
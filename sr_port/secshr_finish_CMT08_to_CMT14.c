@@ -476,7 +476,10 @@ void	secshr_finish_CMT08_to_CMT14(sgmnt_addrs *csa, jnlpool_addrs_ptr_t update_j
 						assert(process_id == cr->in_cw_set);
 						assert(cr->blk == cs->cr->blk);
 					} else
+					{
 						blk_ptr = MM_BASE_ADDR(csa) + (off_t)blk_size * cs->blk;
+						cnl->mm_dirty_cnt = MM_DIRTY_ALL;	/* not worth a wcs_mm_dirty here */
+					}
 					/* Step CMT10 end */
 					/* If BG and DSE, it is possible cache-records corresponding to global buffers which
 					 * are pointed to by the update array are not pinned (because dse passes "dummy_hist"
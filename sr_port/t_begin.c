@@ -27,6 +27,7 @@
 #include "tp.h"
 #include "t_begin.h"
 #include "have_crit.h"
+#include "db_snapshot.h"
 #ifdef DEBUG
 #include "tp_frame.h"
 #endif
@@ -121,6 +122,8 @@ void t_begin(uint4 err, uint4 upd_trans) 	/* err --> error code for current gvcs
 	assert((0 == fast_lock_count) || process_exiting);
 	fast_lock_count = 0;
 	t_tries = 0;
+	if (NULL != cs_addrs->ss_read)
+		cs_addrs->ss_read->used = 0;	/* VIEW "SNAPSHOT" block buffers of the previous transaction are free again */
 	if (non_tp_jfb_ptr)
 		non_tp_jfb_ptr->record_size = 0; /* re-initialize it to 0 since TOTAL_NONTPJNL_REC_SIZE macro uses it */
 	assert(!TREF(donot_commit));
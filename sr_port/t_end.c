@@ -257,9 +257,11 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 	jrec_rsrv_elem_t	*first_jre, *jre, *jre_top;
         int4			event_type, param_val;
         void (*set_fn)(int4 param);
+	gtm_uint64_t		lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
+	GVSTATS_LAT_START(lat_start);	/* recorded only for updates that commit */
 	/* Currently, the only callers of t_end with NULL histories are the update process and journal recovery when they
 	 * are about to process a JRT_NULL record. Assert that.
 	 */
@@ -364,6 +366,8 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 		}
 		for EACH_HIST(hist, hist1, hist2)
 		{
+			if (NULL != csa->ss_read)
+				break;	/* VIEW "SNAPSHOT": private copies of blocks as of the snapshot, which no update modifies */
 			for (t1 = hist->h;  t1->blk_num;  t1++)
 			{	/* Validate block tn */
 				if (!same_db_state && TP_IS_CDB_SC_BLKMOD(t1->cr, t1))
@@ -514,6 +518,8 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 			{
 				assert(0 == cs->blk_checksum);
 				int_depth = (int)cw_set_depth;
+				if (csd->alloc_cluster)
+					cs->blk = bm_cluster_hint(gv_target, cs->blk);
 				if (0 > (cs->blk = bm_getfree(cs->blk, &blk_used, cw_depth, cw_set, &int_depth)))
 				{
 					if (FILE_EXTENDED == cs->blk)
@@ -539,6 +545,8 @@ trans_num t_end(srch_hist *hist1, srch_hist *hist2, trans_num ctn)
 					goto failed_skip_revert;
 				}
 				assert((CDB_STAGNATE > t_tries) || (cs->blk < cti->total_blks));
+				if (csd->alloc_cluster)
+					bm_cluster_note(gv_target, cs->blk);
 				blk_used ? BIT_SET_RECYCLED_AND_CLEAR_FREE(cs->blk_prior_state)
 					 : BIT_CLEAR_RECYCLED_AND_SET_FREE(cs->blk_prior_state);
 				BEFORE_IMAGE_NEEDED(read_before_image, cs, csa, csd, cs->blk, before_image_needed);
@@ -1827,6 +1835,7 @@ skip_cr_array:
 		assert(!jnlpool_csa || (jnlpool_csa == csa));
 		jnlpool = save_jnlpool;
 	}
+	GVSTATS_LAT_END(csa, lat_t_end, lat_start);
 	return dbtn;
 failed:
 	assert(cdb_sc_normal != status);
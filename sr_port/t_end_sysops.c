@@ -88,6 +88,7 @@
 #include "shmpool.h"	/* Needed for the shmpool structures */
 #include "db_snapshot.h"
 #include "wcs_wt.h"
+#include "wcs_mm_msync.h"
 
 error_def(ERR_DBFILERR);
 error_def(ERR_FREEBLKSLOW);
@@ -310,6 +311,7 @@ enum cdb_sc	mm_update(cw_set_element *cs, trans_num ctn, trans_num effective_tn,
 	blkid = cs->blk;
 	assert((0 <= blkid) && (blkid < cs_addrs->ti->total_blks));
 	db_addr[0] = MM_BASE_ADDR(cs_addrs) + (sm_off_t)cs_data->blk_size * (blkid);
+	wcs_mm_dirty(cs_addrs, blkid);	/* so the next wcs_flu msyncs this part of the file */
 	/* check for online backup -- ATTN: this part of code is similar to the BG_BACKUP_BLOCK macro */
 	if ((blkid >= cs_addrs->nl->nbb) && (NULL != cs->old_block)
 		&& (0 == cs_addrs->shmpool_buffer->failed)
@@ -1275,8 +1277,8 @@ void	wcs_timer_start(gd_region *reg, boolean_t io_ok)
 	/* assume defaults for flush_target and buffs_per_flush */
 	flush_target = csd->flush_trigger;
 	buffs_per_flush = 0;
-	if ((0 != csd->epoch_taper) && (0 != cnl->wcs_active_lvl) &&
-			JNL_ENABLED(csd) && (0 != cnl->jnl_file.u.inode) && csd->jnl_before_image)
+	if ((0 != csd->epoch_taper) && (0 != cnl->wcs_active_lvl) && JNL_ENABLED(csd)
+			&& (0 != cnl->jnl_file.u.inode) && csd->jnl_before_image && !FLUSHER_ACTIVE(cnl))
 	{
 		EPOCH_TAPER_IF_NEEDED(csa, csd, cnl, reg, TRUE, buffs_per_flush, flush_target);
 	}
@@ -1295,6 +1297,7 @@ void	wcs_timer_start(gd_region *reg, boolean_t io_ok)
 void	wcs_stale(TID tid, int4 hd_len, gd_region **region)
 {
 	boolean_t		need_new_timer;
+	uint4			flusher_pid;
 	gd_region		*save_region;
 	sgmnt_addrs		*csa, *save_csaddrs, *check_csaddrs;
 	sgmnt_data_ptr_t	csd, save_csdata;
@@ -1382,7 +1385,16 @@ void	wcs_stale(TID tid, int4 hd_len, gd_region **region)
 		switch (acc_meth)
 		{
 			case dba_bg:
-				if (!FROZEN_CHILLED(csa))
+				flusher_pid = cnl->flusher_pid;
+				if (flusher_pid && !is_proc_alive(flusher_pid, 0))
+				{	/* MUPIP FLUSHER was killed without running down; take its job back */
+					cnl->flusher_pid = 0;
+					flusher_pid = 0;
+				}
+				if (flusher_pid)
+				{	/* MUPIP FLUSHER takes care of stale buffers */
+					need_new_timer = FALSE;
+				} else if (!FROZEN_CHILLED(csa))
 				{	/* Flush at least some of our cache */
 					wcs_wtstart(reg, 0, NULL, NULL);
 					/* If there is no dirty buffer left in the active queue, then no need for new timer */
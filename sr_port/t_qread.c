@@ -59,6 +59,7 @@
 #include "wcs_backoff.h"
 #include "wcs_wt.h"
 #include "wcs_recover.h"
+#include "db_snapshot.h"
 
 GBLDEF srch_blk_status	*first_tp_srch_status;	/* the first srch_blk_status for this block in this transaction */
 GBLDEF unsigned char	rdfail_detail;	/* t_qread uses a 0 return to indicate a failure (no buffer filled) and the real
@@ -166,6 +167,19 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 	csd = csa->hdr;
 	INCR_DB_CSH_COUNTER(csa, n_t_qreads, 1);
 	is_mm = (dba_mm == csd->acc_meth);
+	if (NULL != csa->ss_read)
+	{	/* VIEW "SNAPSHOT": the block as of this process' snapshot of the region, in a private buffer. Such a buffer
+		 * never changes, so a TP transaction that already read the block just gets the same buffer back.
+		 */
+		*cycle = CYCLE_PVT_COPY;
+		*cr_out = 0;
+		if (dollar_tlevel && (NULL != (tabent = lookup_hashtab_int4(sgm_info_ptr->blks_in_use, (uint4 *)&blk))))
+		{
+			first_tp_srch_status = tabent->value;
+			return first_tp_srch_status->buffaddr;
+		}
+		return ss_snapshot_read(blk);
+	}
 	/* We better hold crit in the final retry (TP & non-TP). Only exception is journal recovery */
 	assert((t_tries < CDB_STAGNATE) || csa->now_crit || mupip_jnl_recover);
 	if (dollar_tlevel)
@@ -409,7 +423,7 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 				buffs_per_flush = 0;
 				if ((0 != csd->epoch_taper) && (FALSE == gv_cur_region->read_only) && JNL_ENABLED(csd) &&
 						(0 != cnl->wcs_active_lvl) && (NOJNL != csa->jnl->channel) &&
-						(0 != cnl->jnl_file.u.inode) && csd->jnl_before_image)
+						(0 != cnl->jnl_file.u.inode) && csd->jnl_before_image && !FLUSHER_ACTIVE(cnl))
 				{
 					EPOCH_TAPER_IF_NEEDED(csa, csd, cnl, (gd_region *) 0, FALSE, buffs_per_flush, flush_target);
 				}
@@ -546,6 +560,10 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 				assert(was_crit == csa->now_crit);
 				if (reset_first_tp_srch_status)
 					RESET_FIRST_TP_SRCH_STATUS(first_tp_srch_status, cr, *cycle);
+				if (((blk_hdr_ptr_t)buffaddr)->levl)
+					INCR_GVSTATS_COUNTER(csa, cnl, n_csh_miss_index, 1);
+				else
+					INCR_GVSTATS_COUNTER(csa, cnl, n_csh_miss_data, 1);
 				return buffaddr;
 			} else  if (!was_crit && (BAD_LUCK_ABOUNDS > ocnt))
 			{
@@ -706,7 +724,12 @@ sm_uc_ptr_t t_qread(block_id blk, sm_int_ptr_t cycle, cache_rec_ptr_ptr_t cr_out
 				 * corresponds to "blk" passed in. It is crucial to get an accurate value for both the fields
 				 * since "tp_hist" relies on this for its intermediate validation.
 				 */
-				return (sm_uc_ptr_t)GDS_ANY_REL2ABS(csa, cr->buffaddr);
+				buffaddr = (sm_uc_ptr_t)GDS_ANY_REL2ABS(csa, cr->buffaddr);
+				if (((blk_hdr_ptr_t)buffaddr)->levl)
+					INCR_GVSTATS_COUNTER(csa, cnl, n_csh_hit_index, 1);
+				else
+					INCR_GVSTATS_COUNTER(csa, cnl, n_csh_hit_data, 1);
+				return buffaddr;
 			}
 			if (blk != cr->blk)
 				break;
@@ -167,5 +167,5 @@ TAB_BG_TRC_REC("  JnlBuff Phs2Cmt PrcAlv", jnlbuff_phs2cmt_isprcalv)
  * of the filler section.
  */
 TAB_BG_TRC_REC("                        ", filler1)
-TAB_BG_TRC_REC("                        ", filler2)
+TAB_BG_TRC_REC("  TP nodeconflict recomp", tp_nodeconflict_recompute)
 TAB_BG_TRC_REC("  Lock Hash Bucket Full ", lock_hash_bucket_full)
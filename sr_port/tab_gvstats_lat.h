@@ -0,0 +1,24 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+/* Database operations whose latency is recorded in the node_local gvstats shards when $ydb_gvstats_latency is set.
+ * The order defines the layout of the histograms in shared memory. Additions are to be done at the END of the file.
+ */
+TAB_GVSTATS_LAT(lat_crit             , "CRIT", "grab crit                             ")
+TAB_GVSTATS_LAT(lat_dsk_read         , "DRD ", "database block read from disk         ")
+TAB_GVSTATS_LAT(lat_jnl_fsync        , "JFS ", "journal file fsync                    ")
+TAB_GVSTATS_LAT(lat_get              , "GET ", "global GET                            ")
+TAB_GVSTATS_LAT(lat_set              , "SET ", "global SET                            ")
+TAB_GVSTATS_LAT(lat_kill             , "KIL ", "global KILL/ZKILL                     ")
+TAB_GVSTATS_LAT(lat_t_end            , "TEN ", "non-TP commit (t_end)                 ")
+TAB_GVSTATS_LAT(lat_tp_tend          , "TPC ", "TP commit (tp_tend)                   ")
+TAB_GVSTATS_LAT(lat_jnl_write        , "JWR ", "journal record write to buffer        ")
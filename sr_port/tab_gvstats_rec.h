@@ -78,3 +78,8 @@ TAB_GVSTATS_REC(n_crit_que_slps      , "CQT", "# of grab crit queued sleeps
 TAB_GVSTATS_REC(sq_crit_yields       , "CYS", "sum squares grab crit yields          ")
 TAB_GVSTATS_REC(n_crit_yields        , "CYT", "# of grab crit yields                 ")
 TAB_GVSTATS_REC(n_clean2dirty        , "BTD", "# of Block Transitions to Dirty       ")
+TAB_GVSTATS_REC(n_csh_hit_index      , "CHI", "# of Cache Hits on Index blocks       ")
+TAB_GVSTATS_REC(n_csh_miss_index     , "CMI", "# of Cache Misses on Index blocks     ")
+TAB_GVSTATS_REC(n_csh_hit_data       , "CHD", "# of Cache Hits on Data blocks        ")
+TAB_GVSTATS_REC(n_csh_miss_data      , "CMD", "# of Cache Misses on Data blocks      ")
+TAB_GVSTATS_REC(n_kill_defer_pend    , "KDP", "# of Killed subtrees Pending free     ")
@@ -155,6 +155,8 @@ gv_namehead *targ_alloc(int keysize, mname_entry *gvent, gd_region *reg)
 	gvt->read_local_tn = (trans_num)0;
 	GTMTRIG_ONLY(gvt->trig_local_tn = (trans_num)0);
 	gvt->noisolation = FALSE;
+	gvt->fill_factor = 0;
+	gvt->alloc_next = 0;
 	gvt->alt_hist = (srch_hist *)malloc(SIZEOF(srch_hist));
 	gvt->hist.h[0].blk_num = HIST_TERMINATOR;
 	gvt->alt_hist->h[0].blk_num = HIST_TERMINATOR;
@@ -174,7 +174,7 @@ enum cdb_sc tp_hist(srch_hist *hist1)
 			 * tn) that the block hasn't changed when actually its contents have.
 			 */
 			chain = *(off_chain *)&blk;
-			if (!chain.flag)
+			if (!chain.flag && (NULL == csa->ss_read))	/* VIEW "SNAPSHOT" blocks never change */
 			{	/* We need to ensure the shared copy hasn't changed since the beginning of the
 				 * transaction since not checking that can cause at least false UNDEFs.
 				 * e.g. Say earlier in this TP transaction we had gone down
@@ -208,8 +208,11 @@ enum cdb_sc tp_hist(srch_hist *hist1)
 					/* Check if the cse already has a recompute list (i.e. NOISOLATION turned ON)
 					 * If so no need to restart the transaction even though the block changed.
 					 * We will detect this change in tp_tend and recompute the update array anyways.
+					 * A recompute list on a global with NOISOLATION turned OFF ($ydb_tpnodeconflict)
+					 * is only good as long as SETs alone reference the block (see below).
 					 */
-					if ((NULL == cse) || !cse->recompute_list_head || cse->write_type)
+					if ((NULL == cse) || !cse->recompute_list_head || cse->write_type
+						|| ((ERR_GVPUTFAIL != t_err) && !t1->blk_target->noisolation))
 					{
 						assert((CDB_STAGNATE > t_tries)
 							|| (ydb_white_box_test_case_enabled
@@ -268,7 +271,8 @@ enum cdb_sc tp_hist(srch_hist *hist1)
 						 * to avoid the performance hit of a check in this frequently used code.
 						 */
 						assert((ERR_GVPUTFAIL == t_err) && (0 == t1->level)
-							&& (t1->blk_target->noisolation || t2->blk_target->noisolation));
+							&& (t1->blk_target->noisolation || t2->blk_target->noisolation
+								|| TREF(tp_nodeconflict)));
 						if (t1->blk_target != t2->blk_target)
 							TREF(donot_commit) |= DONOTCOMMIT_TPHIST_BLKTARGET_MISMATCH;
 #						endif
@@ -428,6 +432,17 @@ enum cdb_sc tp_hist(srch_hist *hist1)
 						local_hash_entry->cse = t1->cse;
 					}
 				}
+				/* A leaf block of a global with NOISOLATION turned OFF can have a recompute list only if it has
+				 * seen nothing but blind SETs so far ($ydb_tpnodeconflict). Now that something other than a SET
+				 * has looked at it, its contents matter to the transaction so a concurrent change to it has to
+				 * cause a restart. Drop the recompute list at all transaction levels to ensure that.
+				 */
+				if ((ERR_GVPUTFAIL != t_err) && !t1->level && !t1->blk_target->noisolation
+						&& (NULL != t1->first_tp_srch_status))
+				{
+					for (cse = t1->first_tp_srch_status->cse; NULL != cse; cse = cse->low_tlevel)
+						cse->recompute_list_head = cse->recompute_list_tail = NULL;
+				}
 			}
 			t1->cse = NULL;
 		}
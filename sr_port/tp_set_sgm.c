@@ -26,6 +26,7 @@
 #include "tp.h"
 #include "min_max.h"
 #include "tp_set_sgm.h"
+#include "db_snapshot.h"
 #ifdef GTM_TRIGGER
 #include "gtm_trigger_trc.h"
 #endif
@@ -73,6 +74,8 @@ void tp_set_sgm(void)
 		GTMTRIG_ONLY(csa->db_trigger_cycle = csa->hdr->db_trigger_cycle);
 		GTMTRIG_ONLY(DBGTRIGR((stderr, "tp_set_sgm: Updating csa->db_trigger_cycle to %d\n",
 				       csa->db_trigger_cycle)));
+		if (NULL != csa->ss_read)
+			csa->ss_read->used = 0;	/* VIEW "SNAPSHOT" buffers of the previous transaction are free again */
 		si->tp_set_sgm_done = TRUE;
 		assert(0 == si->update_trans);
 	}
@@ -141,6 +141,7 @@ error_def(ERR_TEXT);
 
 enum cdb_sc	reallocate_bitmap(sgm_info *si, cw_set_element *bml_cse);
 enum cdb_sc	recompute_upd_array(srch_blk_status *hist1, cw_set_element *cse);
+STATICFNDCL boolean_t	tp_tend_hist_doomed(sgm_info *si, sgmnt_data_ptr_t csd, boolean_t is_mm);
 
 boolean_t	tp_crit_all_regions()
 {
@@ -287,11 +288,13 @@ boolean_t	tp_tend()
 	int4			tprestart_syslog_delta;
         int4			event_type, param_val;
         void (*set_fn)(int4 param);
+	gtm_uint64_t		lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
 	assert(dollar_tlevel);
 	assert(0 == jnl_fence_ctl.level);
+	GVSTATS_LAT_START(lat_start);	/* recorded only for updates that commit, in each region updated */
 	status = cdb_sc_normal;
 	save_jnlpool = jnlpool;
 	update_jnlpool = NULL;
@@ -317,8 +320,11 @@ boolean_t	tp_tend()
 		sgm_info_ptr = si;
 		*prev_tp_si_by_ftok = si;
 		prev_tp_si_by_ftok = &si->next_tp_si_by_ftok;
-		if ((cnl->wc_blocked) || (is_mm && (csa->total_blks != csd->trans_hist.total_blks)))
-		{	/* If blocked, or we have MM and file has been extended, force repair */
+		if ((NULL == csa->ss_read)
+			&& ((cnl->wc_blocked) || (is_mm && (csa->total_blks != csd->trans_hist.total_blks))))
+		{	/* If blocked, or we have MM and file has been extended, force repair. Not needed if the region was only read
+			 * through VIEW "SNAPSHOT" since none of its blocks came from the cache or the MM mapping.
+			 */
 			status = cdb_sc_helpedout; /* special status to prevent punishing altruism */
 			assert((CDB_STAGNATE > t_tries) || !is_mm || (csa->total_blks == csd->trans_hist.total_blks));
 			TP_TRACE_HIST(CR_BLKEMPTY, NULL);
@@ -377,8 +383,10 @@ boolean_t	tp_tend()
 			 *    zero. In that case, we might skip the fast path and go ahead and do the validation. The validation
 			 *    logic gets crit anyways and so will salvage the lock and do the necessary recovery and issue
 			 *    DBFLCORRP if it notices that csd->file_corrupt is TRUE.
+			 * 3. Or if the region is read through VIEW "SNAPSHOT", in which case every block was read as of the
+			 *    snapshot transaction number and nothing a concurrent update does can invalidate the read.
 			 */
-			if ((si->start_tn == csd->trans_hist.early_tn) && (0 == cnl->onln_rlbk_pid))
+			if (((si->start_tn == csd->trans_hist.early_tn) && (0 == cnl->onln_rlbk_pid)) || (NULL != csa->ss_read))
 			{	/* read with no change to the transaction history. ensure we haven't overrun
 				 * our history buffer and we have reasonable values for first and last */
 				assert(si->last_tp_hist - si->first_tp_hist <= si->tp_hist_size);
@@ -436,6 +444,14 @@ boolean_t	tp_tend()
 				jnl_participants++;
 			}
 		}
+		/* Before getting crit, check the history for blocks that the validation in crit would certainly fail on
+		 * and restart right away instead of holding crit (and making everyone else wait) to find that out.
+		 */
+		if (do_validation && !csa->now_crit && (CDB_STAGNATE > t_tries) && tp_tend_hist_doomed(si, csd, is_mm))
+		{
+			status = cdb_sc_blkmod;
+			goto failed_skip_revert;
+		}
 		if (region_is_frozen)
 		{	/* Wait for it to be unfrozen before proceeding to commit. This reduces the
 			 * chances that we find it frozen after we grab crit further down below.
@@ -824,9 +840,13 @@ boolean_t	tp_tend()
 					assert(jgbl.gbl_jrec_time >= jbp->prev_jrec_time);
 				}	/* if (journaling) */
 			}
-			/* the following section verifies that the optimistic concurrency was justified */
+			/* the following section verifies that the optimistic concurrency was justified. The history of a region read
+			 * through VIEW "SNAPSHOT" holds process private copies of blocks as of the snapshot, so it is skipped.
+			 */
 			assert(cdb_sc_normal == status);
-			for (t1 = si->first_tp_hist;  t1 != si->last_tp_hist; t1++)
+			assert((NULL == csa->ss_read) || !lcl_update_trans);
+			t1 = (NULL == csa->ss_read) ? si->first_tp_hist : si->last_tp_hist;
+			for ( ;  t1 != si->last_tp_hist; t1++)
 			{
 				assert(NULL != t1->blk_target);
 				cse = t1->cse;
@@ -849,6 +869,8 @@ boolean_t	tp_tend()
 							DEBUG_ONLY(continue;)
 							PRO_ONLY(goto failed;)
 						}
+						if (!t1->blk_target->noisolation)
+							BG_TRACE_PRO_ANY(csa, tp_nodeconflict_recompute);
 					}
 				} else
 				{
@@ -886,16 +908,18 @@ boolean_t	tp_tend()
 								 * a restart. If the need for NOISOLATION optimization for M-kills
 								 * is felt, we need to revisit this.
 								 */
-								if (!t1->blk_target->noisolation || !cse)
+								if (!cse || (!t1->blk_target->noisolation && !cse->recompute_list_head))
 									status = cdb_sc_blkmod;
 								else
-								{
+								{	/* NOISOLATION global or blind SETs only ($ydb_tpnodeconflict) */
 									assert(cse->write_type || cse->recompute_list_head);
 									leafmods++;
 									if (indexmods || cse->write_type
 											|| (cdb_sc_normal !=
 												recompute_upd_array(t1, cse)))
 										status = cdb_sc_blkmod;
+									else if (!t1->blk_target->noisolation)
+										BG_TRACE_PRO_ANY(csa, tp_nodeconflict_recompute);
 								}
 							}
 							if (cdb_sc_normal != status)
@@ -1895,6 +1919,14 @@ skip_failed:
 		if (save_jnlpool != jnlpool)
 			jnlpool = save_jnlpool;
 		first_tp_si_by_ftok = NULL; /* Signal t_commit_cleanup/secshr_db_clnup that TP transaction is NOT underway */
+		if (lat_start)
+		{
+			for (si = first_sgm_info; NULL != si; si = si->next_sgm_info)
+			{
+				if (si->update_trans)
+					GVSTATS_LAT_END(si->tp_csa, lat_tp_tend, lat_start);
+			}
+		}
 		return TRUE;
 	}
 failed_skip_revert:
@@ -1908,6 +1940,43 @@ failed_skip_revert:
 	return FALSE;
 }
 
+/* Out-of-crit pass over the transaction's read history of one region, done before tp_tend gets crit. Returns TRUE only if
+ * some block has certainly been modified since it was read in a way the in-crit validation loop would restart for, i.e.
+ * the indexmod and noisolation (recompute) allowances are left for the in-crit check to decide. As in tp_hist, the block
+ * transaction number is looked at before the cycle: a changed tn only counts if the buffer still holds the same block
+ * afterwards, since a buffer reused for another block says nothing about ours. Anything this misses is caught in crit.
+ */
+STATICFNDEF boolean_t tp_tend_hist_doomed(sgm_info *si, sgmnt_data_ptr_t csd, boolean_t is_mm)
+{
+	srch_blk_status		*t1;
+	cw_set_element		*cse;
+	cache_rec_ptr_t		cr;
+
+	SHM_READ_MEMORY_BARRIER;
+	for (t1 = si->first_tp_hist; t1 != si->last_tp_hist; t1++)
+	{
+		cse = t1->cse;
+		if (cse && cse->recompute_list_head && !cse->write_type && !t1->level)
+			continue;	/* NOISOLATION leaf block: in-crit validation may recompute rather than restart */
+		if (!is_mm)
+		{
+			if (!cse && t1->level)
+				continue;	/* index block not being updated: in-crit validation may allow it (indexmods) */
+			cr = t1->cr;
+			if ((NULL == cr) || !TP_IS_CDB_SC_BLKMOD(cr, t1))
+				continue;
+			SHM_READ_MEMORY_BARRIER;
+			if ((cr->cycle != t1->cycle) || (cr->blk != t1->blk_num))
+				continue;	/* buffer reused since - cannot tell */
+		} else if (t1->tn > ((blk_hdr_ptr_t)t1->buffaddr)->tn)
+			continue;
+		TP_TRACE_HIST_MOD(t1->blk_num, t1->blk_target, tp_blkmod_tp_tend, csd, t1->tn,
+				  ((blk_hdr_ptr_t)t1->buffaddr)->tn, t1->level);
+		return TRUE;
+	}
+	return FALSE;
+}
+
 /* --------------------------------------------------------------------------------------------
  * This code is very similar to the code in gvcst_put for the non-block-split case. Any changes
  * in either place should be reflected in the other.
@@ -1947,7 +2016,7 @@ enum cdb_sc	recompute_upd_array(srch_blk_status *bh, cw_set_element *cse)
 	assert(csa->now_crit && dollar_tlevel && sgm_info_ptr);
 	assert(!cse->level && cse->blk_target && !cse->first_off && !cse->write_type);
 	blk_size = cs_data->blk_size;
-	blk_fill_size = (blk_size * gv_fillfactor) / 100 - cs_data->reserved_bytes;
+	blk_fill_size = (blk_size * GVT_FILLFACTOR(cse->blk_target)) / 100 - cs_data->reserved_bytes;
 	cse->first_copy = TRUE;
 	if (dba_bg == csa->hdr->acc_meth)
 	{	/* For BG method, modify history with uptodate cache-record, buffer and cycle information.
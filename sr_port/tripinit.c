@@ -43,8 +43,7 @@ void tripinit(void)
 		mcavailbase->size = (int4)(MC_DSBLKSIZE - MCALLOC_HDR_SZ);
 	}
 	mcavailptr = mcavailbase;
-	mcavail = mcavailptr->size;
-	memset(&mcavailptr->data[0], 0, mcavail);
+	mcavail = mcavailptr->size;	/* mcalloc() zeroes storage as it hands it out */
 	TREF(expr_start) = TREF(expr_start_orig) = NULL;
 	TREF(saw_side_effect) = TREF(shift_side_effects) = FALSE;
 	if (NULL == TREF(side_effect_base))
@@ -104,8 +104,10 @@ void view_arg_convert(viewtab_entry *vtp, int vtp_parm, mval *parm, viewparm *pa
 			case VTK_GVSRESET:
 			case VTK_JNLERROR:
 			case VTK_JNLFLUSH:
+			case VTK_NOSNAPSHOT:
 			case VTK_NOSTATSHARE:
 			case VTK_POOLLIMIT:
+			case VTK_SNAPSHOT:
 			case VTK_STATSHARE:
 				for (vr = TREF(view_region_list); NULL != vr; vr = vr_nxt)
 				{	/* start with empty list, place all existing entries on free list */
@@ -34,6 +34,7 @@ VIEWTAB("FREEBLOCKS",		VTP_DBREGION,			VTK_BLFREE,		MV_NM),
 VIEWTAB("FREEZE",		VTP_DBREGION,			VTK_FREEZE,		MV_NM),
 VIEWTAB("FULL_BOOLEAN",		VTP_NULL,			VTK_FULLBOOL,		MV_STR),
 VIEWTAB("FULL_BOOLWARN",	VTP_NULL,			VTK_FULLBOOLWARN,	MV_STR),
+VIEWTAB("GBLFILLFACTOR",	VTP_DBKEYLIST,			VTK_GBLFILLFACTOR,	MV_NM),
 VIEWTAB("GDSCERT",		VTP_NULL | VTP_VALUE,		VTK_GDSCERT,		MV_STR),
 #ifdef TESTPOLLCRIT
 VIEWTAB("GRABCRIT",		VTP_DBREGION,			VTK_GRABCRIT,		MV_STR),
@@ -90,6 +91,7 @@ VIEWTAB("NOISOLATION",		VTP_NULL | VTP_DBKEYLIST,	VTK_NOISOLATION,	MV_NM),
 VIEWTAB("NOLOGNONTP",		VTP_NULL,			VTK_NOLOGNONTP,		MV_NM),
 VIEWTAB("NOLOGTPRESTART",	VTP_NULL,			VTK_NOLOGTPRESTART,	MV_NM),
 VIEWTAB("NOLVNULLSUBS",		VTP_NULL,			VTK_NOLVNULLSUBS,	MV_NM),
+VIEWTAB("NOSNAPSHOT",		VTP_NULL | VTP_DBREGION,	VTK_NOSNAPSHOT,		MV_NM),
 VIEWTAB("NOSTATSHARE",		VTP_NULL | VTP_DBREGION,	VTK_NOSTATSHARE,	MV_NM),
 VIEWTAB("NOUNDEF",		VTP_NULL,			VTK_NOUNDEF,		MV_NM),
 VIEWTAB("PATCODE",		VTP_VALUE | VTP_NULL,		VTK_PATCODE,		MV_STR),
@@ -110,11 +112,14 @@ VIEWTAB("RELLOCK",		VTP_DBREGION,			VTK_RELLOCK,		MV_STR),
 VIEWTAB("RESETGVSTATS",		VTP_NULL,			VTK_RESETGVSTATS,	MV_STR),
 VIEWTAB("RTNCHECKSUM",		VTP_RTNAME,			VTK_RTNCHECKSUM,	MV_STR),
 VIEWTAB("RTNNEXT",		VTP_RTNAME,			VTK_RTNEXT,		MV_STR),
+VIEWTAB("RTNSTATS",		VTP_NULL,			VTK_RTNSTATS,		MV_STR),
 VIEWTAB("SETENV",		VTP_VALUE,			VTK_SETENV,		MV_STR),
+VIEWTAB("SNAPSHOT",		VTP_NULL | VTP_DBREGION,	VTK_SNAPSHOT,		MV_NM),
 VIEWTAB("SPSIZE",		VTP_NULL,			VTK_SPSIZE,		MV_STR),
 VIEWTAB("STATSHARE",		VTP_NULL | VTP_DBREGION,	VTK_STATSHARE,		MV_NM),
 VIEWTAB("STKSIZ",		VTP_NULL,			VTK_STKSIZ,		MV_NM),
 VIEWTAB("STORDUMP",		VTP_NULL,			VTK_STORDUMP,		MV_NM), /* nodoc : code debugging feature */
+VIEWTAB("STORSTATS",		VTP_NULL,			VTK_STORSTATS,		MV_STR),
 VIEWTAB("STP_GCOL",		VTP_NULL,			VTK_STPGCOL,		MV_NM),
 VIEWTAB("TESTPOINT",		VTP_VALUE,			VTK_TESTPOINT,		MV_NM),
 VIEWTAB("TOTALBLOCKS",		VTP_DBREGION,			VTK_BLTOTAL,		MV_NM),
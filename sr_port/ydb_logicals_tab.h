@@ -75,12 +75,15 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_EXTRACT_NOCOL,              "$ydb_extract_noc
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_FULLBLOCKWRITES,            "$ydb_fullblockwrites",            "$gtm_fullblockwrites")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GBLDIR,                     "$ydb_gbldir",                     "$gtmgbldir")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GDSCERT,                    "$ydb_gdscert",                    "$gtm_gdscert")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_GVSTATS_LATENCY,            "$ydb_gvstats_latency",            "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_ICU_VERSION,                "$ydb_icu_version",                "$gtm_icu_version")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_IPV4_ONLY,                  "$ydb_ipv4_only",                  "$gtm_ipv4_only")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_JNL_RELEASE_TIMEOUT,        "$ydb_jnl_release_timeout",        "$gtm_jnl_release_timeout")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_KILL_DEFER_FREE,            "$ydb_kill_defer_free",            "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LCT_STDNULL,                "$ydb_lct_stdnull",                "$gtm_lct_stdnull")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINK,                       "$ydb_link",                       "$gtm_link")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINKTMPDIR,                 "$ydb_linktmpdir",                 "$gtm_linktmpdir")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LINK_MMAP,                  "$ydb_link_mmap",                  "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCALE,                     "$ydb_locale",                     "$gtm_locale")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOCAL_COLLATE,              "$ydb_local_collate",              "$gtm_local_collate")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_LOG,                        "$ydb_log",                        "$gtm_log")
@@ -131,6 +134,7 @@ YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TLS_PASSWD_PREFIX,          "$ydb_tls_passwd_
  */
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TMP,                        "$ydb_tmp",                        "$gtm_tmp")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TMP_ONLY,                   "$ydb_tmp",                        "")
+YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPNODECONFLICT,             "$ydb_tpnodeconflict",             "")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPNOTACIDTIME,              "$ydb_tpnotacidtime",              "$gtm_tpnotacidtime")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPRESTART_LOG_DELTA,        "$ydb_tprestart_log_delta",        "$gtm_tprestart_log_delta")
 YDBENVINDX_TABLE_ENTRY (YDBENVINDX_TPRESTART_LOG_FIRST,        "$ydb_tprestart_log_first",        "$gtm_tprestart_log_first")
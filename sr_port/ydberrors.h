@@ -44,3 +44,5 @@
 #define ERR_THREADEDAPINOTALLOWED 151027946
 #define ERR_SIMPLEAPINOTALLOWED 151027954
 #define ERR_STAPIFORKEXEC 151027962
+#define ERR_SNAPSHOTFAIL 151027970
+#define ERR_SNAPSHOTNOTALLOWED 151027978
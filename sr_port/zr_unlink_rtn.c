@@ -89,6 +89,9 @@ void zr_unlink_rtn(rhdtyp *old_rhead, boolean_t free_all)
 			rtnobj_shm_free(old_rhead, LATCH_GRABBED_FALSE); /* Object is shared via rtnobj shared memory */
 		else
 #		endif
+		if (RTN_TEXT_MAPPED(old_rhead))
+			link_unmap_sect_ro_rel(old_rhead);	/* Process private object mapped from the object file */
+		else
 		{	/* Process private linked object */
 			GTM_TEXT_FREE(old_rhead->ptext_adr);
 		}
@@ -97,6 +97,7 @@ void		zshow_svn(zshow_out *output, int svn);
 void		zshow_zbreaks(zshow_out *output);
 void		zshow_zcalls(zshow_out *output);
 void		zshow_gvstats(zshow_out *output, boolean_t total_only);
+void		zshow_gvstats_lat(zshow_out *output);
 void		zshow_zwrite(zshow_out *output);
 boolean_t	zwr2format(mstr *src, mstr *des);
 int		zwrkeyvallen(char* ptr, int len, char **val_off, int *val_len, int *val_off1, int *val_len1);
@@ -29,6 +29,7 @@
 #define	KEYWORD_SEPARATOR	":"
 #define	GLD_KEYWORD		"GLD" KEYWORD_SEPARATOR
 #define	REG_KEYWORD		"REG" KEYWORD_SEPARATOR
+#define	OP_KEYWORD		"OP" KEYWORD_SEPARATOR
 #define	STAR_GLD		"*"
 #define	STAR_REG		"*"
 
@@ -36,10 +37,12 @@ MSTR_CONST(stargldname, STAR_GLD);
 MSTR_CONST(starregname, STAR_REG);
 MSTR_CONST(gldkeyword, GLD_KEYWORD);
 MSTR_CONST(regkeyword, REG_KEYWORD);
+MSTR_CONST(opkeyword, OP_KEYWORD);
 MSTR_CONST(keywordseparator, KEYWORD_SEPARATOR);
 MSTR_CONST(keywordterminator, KEYWORD_TERMINATOR);
 
 STATICFNDCL void zshow_gvstats_output(zshow_out *output, mstr *gldname, mstr *regname, gvstats_rec_t *gvstats, boolean_t current);
+STATICFNDCL void zshow_gvstats_lat_field(zshow_out *output, char *name, gtm_uint64_t value);
 
 STATICFNDEF void zshow_gvstats_output(zshow_out *output, mstr *gldname, mstr *regname, gvstats_rec_t *gvstats, boolean_t current)
 {
@@ -130,3 +133,84 @@ void zshow_gvstats(zshow_out *output, boolean_t total_only)
 		}
 	}
 }
+
+STATICFNDEF void zshow_gvstats_lat_field(zshow_out *output, char *name, gtm_uint64_t value)
+{
+	unsigned char	valstr[MAX_DIGITS_IN_INT8];
+	uchar_ptr_t	ptr;
+	mstr		valmstr;
+
+	zshow_output(output, &keywordterminator);
+	valmstr.addr = name;
+	valmstr.len = STRLEN(name);
+	zshow_output(output, &valmstr);
+	zshow_output(output, &keywordseparator);
+	ptr = i2ascl((uchar_ptr_t)valstr, value);
+	valmstr.len = (mstr_len_t)(ptr - &valstr[0]);
+	valmstr.addr = (char *)&valstr[0];
+	zshow_output(output, &valmstr);
+}
+
+/* ZSHOW "H" : one line per <gld,reg,operation> with a non-empty latency histogram (see tab_gvstats_lat.h). The histograms
+ * are those of the database shared memory so they cover all processes, but are only maintained by processes that
+ * have $ydb_gvstats_latency set. All times are in microseconds.
+ */
+void zshow_gvstats_lat(zshow_out *output)
+{
+	enum db_acc_method	acc_meth;
+	gd_addr			*addr_ptr;
+	gd_region		*reg, *r_top;
+	gvstats_lat_t		lat[n_gvstats_lat_types];
+	gtm_uint64_t		count;
+	mstr			gldname, regname, opname;
+	sgmnt_addrs             *csa;
+	int			type;
+	static readonly char	*opnames[] = {
+#						define TAB_GVSTATS_LAT(TYPE,TEXT1,TEXT2)	TEXT1,
+#						include "tab_gvstats_lat.h"
+#						undef TAB_GVSTATS_LAT
+					     };
+
+	for (addr_ptr = get_next_gdr(NULL); addr_ptr; addr_ptr = get_next_gdr(addr_ptr))
+	{
+		get_first_gdr_name(addr_ptr, &gldname);
+		for (reg = addr_ptr->regions, r_top = reg + addr_ptr->n_regions; reg < r_top; reg++)
+		{
+			if (!reg->open || reg->was_open || IS_STATSDB_REG(reg))
+				continue;
+			acc_meth = reg->dyn.addr->acc_meth;
+			if (!IS_ACC_METH_BG_OR_MM(acc_meth))
+				continue;
+			csa = &FILE_INFO(reg)->s_addrs;
+			regname.len = reg->rname_len;
+			regname.addr = (char *)&reg->rname[0];
+			gvstats_lat_cnl_sum(csa->nl, lat);
+			for (type = 0; type < n_gvstats_lat_types; type++)
+			{
+				count = gvstats_lat_count(&lat[type]);
+				if (0 == count)
+					continue;
+				opname.addr = opnames[type];
+				for (opname.len = STRLEN(opname.addr); (0 < opname.len) && (' ' == opname.addr[opname.len - 1]); )
+					opname.len--;	/* the names are blank padded for DSE */
+				output->flush = FALSE;
+				zshow_output(output, &gldkeyword);
+				zshow_output(output, &gldname);
+				zshow_output(output, &keywordterminator);
+				zshow_output(output, &regkeyword);
+				zshow_output(output, &regname);
+				zshow_output(output, &keywordterminator);
+				zshow_output(output, &opkeyword);
+				zshow_output(output, &opname);
+				zshow_gvstats_lat_field(output, "CNT", count);
+				zshow_gvstats_lat_field(output, "AVG", lat[type].sum_usec / count);
+				zshow_gvstats_lat_field(output, "P50", gvstats_lat_percentile(&lat[type], count, 500));
+				zshow_gvstats_lat_field(output, "P90", gvstats_lat_percentile(&lat[type], count, 900));
+				zshow_gvstats_lat_field(output, "P99", gvstats_lat_percentile(&lat[type], count, 990));
+				zshow_gvstats_lat_field(output, "P999", gvstats_lat_percentile(&lat[type], count, 999));
+				output->flush = TRUE;
+				zshow_output(output, NULL);
+			}
+		}
+	}
+}
@@ -100,6 +100,16 @@ typedef struct snapshot_filehdr_struct
 	unsigned char	filler[976];
 } snapshot_filhdr_t;
 
+/* Process private state of a region that VIEW "SNAPSHOT" has this process read as of its own snapshot (see ss_snapshot_read.c) */
+typedef struct snapshot_read_struct
+{
+	trans_num	snapshot_tn;	/* Transaction number at which the snapshot started */
+	int		nbuffs;		/* Number of block buffers allocated in "buffs" */
+	int		used;		/* Buffers handed out since the current transaction began */
+	sm_uc_ptr_t	*buffs;		/* OS page aligned block buffers; malloc'ed one at a time so a history never sees them move */
+	uchar_ptr_t	*free_buffs;	/* What was malloc'ed for the corresponding "buffs" entry */
+} snapshot_read_t;
+
 typedef	snapshot_filhdr_t	*snapshot_filhdr_ptr_t;
 typedef util_snapshot_t		*util_snapshot_ptr_t;
 typedef snapshot_context_t	*snapshot_context_ptr_t;
@@ -178,6 +188,14 @@ boolean_t	ss_destroy_context(snapshot_context_ptr_t );
 
 void		ss_anal_shdw_file(char *, int);
 
+void		ss_snapshot_read_begin(void);
+
+void		ss_snapshot_read_end(void);
+
+void		ss_snapshot_read_free(snapshot_read_t *);
+
+sm_uc_ptr_t	ss_snapshot_read(block_id);
+
 void		ss_initiate_call_on_signal(void);
 
 #endif
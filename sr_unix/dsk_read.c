@@ -98,6 +98,7 @@ int4	dsk_read (block_id blk, sm_uc_ptr_t buff, enum db_ver *ondsk_blkver, boolea
 	char			*in, *out;
 	boolean_t		db_is_encrypted, use_new_key;
 	intrpt_state_t		prev_intrpt_state;
+	gtm_uint64_t		lat_start;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -154,7 +155,9 @@ int4	dsk_read (block_id blk, sm_uc_ptr_t buff, enum db_ver *ondsk_blkver, boolea
 		enc_save_buff = GDS_ANY_ENCRYPTGLOBUF(buff, csa);
 		DBG_ENSURE_PTR_IS_VALID_ENCTWINGLOBUFF(csa, csd, enc_save_buff);
 	}
+	GVSTATS_LAT_START(lat_start);
 	DB_LSEEKREAD(udi, udi->fd, (BLK_ZERO_OFF(csd->start_vbn) + (off_t)blk * size), enc_save_buff, size, save_errno);
+	GVSTATS_LAT_END(csa, lat_dsk_read, lat_start);
 	assert((0 == save_errno) || (-1 == save_errno));
 	WBTEST_ASSIGN_ONLY(WBTEST_PREAD_SYSCALL_FAIL, save_errno, EIO);
 	if ((enc_save_buff != buff) && (0 == save_errno))
@@ -60,6 +60,7 @@
 #include "wcs_mm_recover.h"
 #include "tp_change_reg.h"
 #include "wcs_flu.h"
+#include "wcs_mm_msync.h"
 #include "add_inter.h"
 #include "io.h"
 #include "gtmsecshr.h"
@@ -481,6 +482,13 @@ int4 gds_rundown(boolean_t cleanup_udi)
 		assert(!(have_standalone_access && !reg->read_only) || we_are_last_writer || jgbl.onlnrlbk || inst_is_frozen);
 		GTM_WHITE_BOX_TEST(WBTEST_ANTIFREEZE_JNLCLOSE, we_are_last_writer, 1);
 			/* Assume we are the last writer to invoke wcs_flu */
+		if (process_id == cnl->flusher_pid)
+			cnl->flusher_pid = 0;	/* MUPIP FLUSHER going away; processes flush for themselves again */
+		if (NULL != csa->ss_read)
+		{	/* VIEW "SNAPSHOT" still in effect; as its initiator we clean up the snapshot itself below */
+			ss_snapshot_read_free(csa->ss_read);
+			csa->ss_read = NULL;
+		}
 		if (NULL != csa->ss_ctx)
 		{
 			ss_destroy_context(csa->ss_ctx);
@@ -763,7 +771,7 @@ int4 gds_rundown(boolean_t cleanup_udi)
 					GTM_DB_FSYNC(csa, udi->fd, rc);
 					if (-1 == rc)
 #					else
-					if (-1 == MSYNC((caddr_t)csa->db_addrs[0], (caddr_t)csa->db_addrs[1]))
+					if (-1 == wcs_mm_msync(csa))
 #					endif
 					{
 						rts_error_csa(CSA_ARG(csa) VARLSTCNT(9) ERR_DBFILERR, 2, DB_LEN_STR(reg),
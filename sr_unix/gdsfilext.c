@@ -583,3 +583,32 @@ uint4	 gdsfilext(uint4 blocks, uint4 filesize, boolean_t trans_in_prog)
 	}
 	return (SS_NORMAL);
 }
+
+/* Called outside crit (by MUPIP FLUSHER) for a region with MUPIP SET -EXTEND_AHEAD once fewer than that percentage of its
+ * blocks are free, to extend the file by extension_size blocks before an update runs out of free blocks and has to extend it
+ * from bm_getfree. The disk space for the extension is first reserved beyond the end of the file without holding crit and
+ * without changing the file size, so the posix_fallocate that gdsfilext does in crit finds it already allocated. If an
+ * update extends (or MUPIP REORG -TRUNCATE shrinks) the file in between, gdsfilext notices the changed total and does nothing.
+ */
+uint4	gdsfilext_ahead(void)
+{
+	uint4			blocks, bplmap, total_blks;
+	off_t			old_size, len;
+
+	assert(!cs_addrs->now_crit);
+	assert(!gv_cur_region->read_only && (dba_bg == cs_data->acc_meth));
+	blocks = cs_data->extension_size;
+	total_blks = cs_addrs->ti->total_blks;
+	if (!blocks || (blocks > (MAXTOTALBLKS(cs_data) - total_blks)))
+		return (uint4)(NO_FREE_SPACE);
+#	ifdef __linux__
+	if (!cs_data->defer_allocate)
+	{	/* Enough for the blocks, the local bitmaps they could need and the EOF block. Failures are left to gdsfilext */
+		bplmap = cs_data->bplmap;
+		old_size = BLK_ZERO_OFF(cs_data->start_vbn) + ((off_t)total_blks * cs_data->blk_size);
+		len = ((off_t)blocks + DIVIDE_ROUND_UP(blocks, bplmap - 1) + 2) * cs_data->blk_size;
+		fallocate(FILE_INFO(gv_cur_region)->fd, FALLOC_FL_KEEP_SIZE, old_size, len);
+	}
+#	endif
+	return GDSFILEXT(blocks, total_blks, TRANS_IN_PROG_FALSE);
+}
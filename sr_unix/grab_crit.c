@@ -65,6 +65,7 @@ void	grab_crit(gd_region *reg)
 	enum cdb_sc		status;
 	mutex_spin_parms_ptr_t	mutex_spin_parms;
 	intrpt_state_t		prev_intrpt_state;
+	gtm_uint64_t		lat_start;
 #	ifdef DEBUG
 	sgmnt_addrs		*jnlpool_csa;
 	jnlpool_addrs_ptr_t	local_jnlpool, save_jnlpool;
@@ -111,6 +112,7 @@ void	grab_crit(gd_region *reg)
 		TREF(grabbing_crit) = reg;
 		DEBUG_ONLY(locknl = cnl;)	/* for DEBUG_ONLY LOCK_HIST macro */
 		mutex_spin_parms = (mutex_spin_parms_ptr_t)&csd->mutex_spin_parms;
+		GVSTATS_LAT_START(lat_start);
 		status = gtm_mutex_lock(reg, mutex_spin_parms, crash_count, MUTEX_LOCK_WRITE);
 		assert((NULL == local_jnlpool) || (local_jnlpool == jnlpool));
 #		ifdef DEBUG
@@ -152,6 +154,7 @@ void	grab_crit(gd_region *reg)
 		 */
 		assert((0 == cnl->in_crit) || (FALSE == is_proc_alive(cnl->in_crit, 0)));
 		cnl->in_crit = process_id;
+		GVSTATS_LAT_END(csa, lat_crit, lat_start);
 		CRIT_TRACE(csa, crit_ops_gw);	/* see gdsbt.h for comment on placement */
 		TREF(grabbing_crit) = NULL;
 		ENABLE_INTERRUPTS(INTRPT_IN_CRIT_FUNCTION, prev_intrpt_state);
@@ -303,6 +303,10 @@ void	gtm_env_init_sp(void)
 	{
 		init_relink_allowed(&trans); /* set TREF(relink_allowed) */
 	}
+	/* See if ydb_link_mmap is set */
+	TREF(link_mmap) = ydb_logical_truth_value(YDBENVINDX_LINK_MMAP, FALSE, &is_defined);
+	if (!is_defined)
+		TREF(link_mmap) = FALSE;
 #	ifdef AUTORELINK_SUPPORTED
 	if (!IS_GTMSECSHR_IMAGE)
 	{	/* Set default or supplied value for $ydb_linktmpdir */
@@ -25,6 +25,7 @@
 #include "hashtab_mname.h"
 #include "stack_frame.h"
 #include "mprof.h"
+#include "mdq.h"
 #include "gtm_unlink_all.h"
 #include "zbreak.h"
 #include "gtm_text_alloc.h"
@@ -53,6 +54,7 @@ GBLREF	gv_key			*gv_currkey;
 GBLREF	hash_table_objcode	cache_table;
 GBLREF	int			dollar_truth;
 GBLREF	int			indir_cache_mem_size;
+GBLREF	cache_entry		cache_lru_queue;
 GBLREF	rtn_tabent		*rtn_names, *rtn_names_end, *rtn_names_top, *rtn_fst_table;
 GBLREF	stack_frame		*frame_pointer;
 GBLREF	gv_namehead		*gv_target_list;
@@ -150,6 +152,7 @@ void gtm_unlink_all(void)
 	}
 	reinitialize_hashtab_objcode(&cache_table);	/* Completely re-initialize the hash table */
 	indir_cache_mem_size = 0;
+	dqinit(&cache_lru_queue, lru);
 	/* Step 6: Close all M code shared libraries */
 	zro_shlibs_unlink_all();
 }
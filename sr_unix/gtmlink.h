@@ -21,6 +21,18 @@ enum ydb_link_type
 	LINK_MAXTYPE
 };
 
+/* Counters of how the read-only releasable (code) section of process private objects was brought in ($VIEW("RTNSTATS")).
+ * With $ydb_link_mmap set, the section is mapped from the object file so all processes running that object share the
+ * same page cache pages; otherwise (or if the map cannot be made) it is read into process private storage.
+ */
+typedef struct
+{
+	gtm_uint64_t	mapCnt;				/* Objects whose code section was mmap()ed */
+	gtm_uint64_t	mapBytes;			/* Bytes of code section mmap()ed (shared) */
+	gtm_uint64_t	readCnt;			/* Objects whose code section was read into private storage */
+	gtm_uint64_t	readBytes;			/* Bytes of code section read into private storage */
+} linkStats_t;
+
 void init_relink_allowed(mstr *keyword);
 #ifdef DEBUG
 void check_max_keyword_len(void);
@@ -732,7 +732,8 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 	char			s[JNLBUFFUPDAPNDX_SIZE];	/* JNLBUFFUPDAPNDX_SIZE is defined in jnl.h */
 	char			*syscall;
 	void			*mmapaddr;
-	int			ret, secshrstat;
+	int			ret, secshrstat, shm_flags;
+	uint4			shm_numa_nodes, shm_page_size;
 	boolean_t		crypt_warning;
 	gd_region		*baseDBreg;
 	sgmnt_addrs		*baseDBcsa;
@@ -1235,7 +1236,22 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 		dbsecspc(reg, tsd, &sec_size); 	/* Find db segment size */
 		/* Create new shared memory using IPC_PRIVATE. System guarantees a unique id */
 		GTM_WHITE_BOX_TEST(WBTEST_FAIL_ON_SHMGET, sec_size, GTM_UINT64_MAX);
-		if (-1 == (status_l = udi->shmid = shmget(IPC_PRIVATE, sec_size, RWDALL | IPC_CREAT)))
+		shm_flags = RWDALL | IPC_CREAT;
+		shm_page_size = OS_PAGE_SIZE;
+#		ifdef __linux__
+		if (tsd->shm_huge_page_mb)
+		{	/* MUPIP SET -HUGE_PAGES: ask for the segment to be backed by huge pages of that size. If there are not
+			 * enough of them reserved (or we may not use them), note it in the syslog and use normal pages.
+			 */
+			if (-1 != (udi->shmid = shmget(IPC_PRIVATE, sec_size, shm_flags | SHM_HUGE_PAGE_FLAGS(tsd->shm_huge_page_mb))))
+				shm_page_size = tsd->shm_huge_page_mb * (1024 * 1024);
+			else
+				SEND_MSG(VARLSTCNT(8) ERR_SYSCALL, 5, LEN_AND_LIT("shmget() with SHM_HUGETLB"), CALLFROM, errno);
+		}
+		if (OS_PAGE_SIZE == shm_page_size)
+#		endif
+			udi->shmid = shmget(IPC_PRIVATE, sec_size, shm_flags);
+		if (-1 == (status_l = udi->shmid))
 		{
 			udi->shmid = (int)INVALID_SHMID;
 			status_l = INVALID_SHMID;
@@ -1275,6 +1291,11 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 				ERR_TEXT, 2, LEN_AND_LIT("Error with database control shmctl IPC_STAT2"), errno);
 		tsd->gt_shm_ctime.ctime = udi->gt_shm_ctime = shmstat.shm_ctime;
 		GTM_ATTACH_SHM;
+		shm_numa_nodes = 0;
+#		ifdef __linux__
+		if (tsd->shm_numa_interleave)	/* MUPIP SET -NUMA_INTERLEAVE: place the pages before anything touches them */
+			shm_numa_nodes = shm_numa_interleave(csa->db_addrs[0], ROUND_UP(sec_size, shm_page_size));
+#		endif
 		shm_setup_ok = TRUE;
 	} else
 	{
@@ -1322,6 +1343,8 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 			assert('\0' == ptr[i]);
 #		endif
 		cnl->sec_size = sec_size;			/* Set the shared memory size 			     */
+		cnl->shm_page_size = shm_page_size;		/* and how it was laid out, for DSE DUMP -FILEHEADER */
+		cnl->shm_numa_nodes = shm_numa_nodes;
 		if (JNL_ALLOWED(csa))
 		{	/* initialize jb->cycle to a value different from initial value of jpc->cycle (0). although this is not
 			 * necessary right now, in the future, the plan is to change "jnl_ensure_open" to only do a cycle mismatch
@@ -1775,6 +1798,8 @@ int db_init(gd_region *reg, boolean_t ok_to_bypass)
 	 * both callers. Therefore use interlocked INCR_CNT/DECR_CNT.
 	 */
 	INCR_CNT(&cnl->ref_cnt, &cnl->wc_var_lock);
+	/* Hand out the gvstats_shard[] slots round robin (INCR_CNT returns the incremented value) */
+	csa->gvstats_shard = (INCR_CNT(&cnl->gvstats_shard_next, &cnl->wc_var_lock) - 1) & (GVSTATS_SHARD_CNT - 1);
 	assert(!csa->ref_cnt);	/* Increment shared ref_cnt before private ref_cnt increment. */
 	csa->ref_cnt++;		/* Currently journaling logic in gds_rundown() in VMS relies on this order to detect last writer */
 	if (WBTEST_ENABLED(WBTEST_HOLD_SEM_BYPASS) && !IS_GTM_IMAGE)
@@ -24,6 +24,13 @@
 #	define		HUGEPAGE_LIB_NAME	"libhugetlbfs.so"
 	extern int	gtm_shmget(key_t key, size_t size, int shmflg);
 	void 		libhugetlbfs_init(void);
+	int		shm_numa_interleave(void *addr, size_t len);
+
+#	ifndef SHM_HUGE_SHIFT
+#		define	SHM_HUGE_SHIFT	26
+#	endif
+	/* shmget flags asking for a segment backed by huge pages of MB (a power of 2) MiB (MUPIP SET -HUGE_PAGES) */
+#	define	SHM_HUGE_PAGE_FLAGS(MB)	(SHM_HUGETLB | ((20 + ceil_log2_32bit(MB)) << SHM_HUGE_SHIFT))
 #endif
 
 #ifdef HUGETLB_SUPPORTED
@@ -17,6 +17,7 @@
 
 #include <sys/types.h>
 #include <sys/shm.h>
+#include <sys/mman.h>
 
 #include <errno.h>
 #include "gtm_string.h"
@@ -45,6 +46,9 @@
 #include "interlock.h"
 #include "util.h"
 #include "arlinkdbg.h"
+#include "gtmlink.h"
+#include "hashtab.h"
+#include "hashtab_addr.h"
 
 /* Define linkage types */
 typedef enum
@@ -98,12 +102,17 @@ typedef enum
  * *not* be shared amongst the threads of the future.
  */
 static unsigned char	*sect_ro_rel, *sect_rw_rel, *sect_rw_nonrel;
+static size_t		sect_ro_map_len;	/* Non-zero if sect_ro_rel is mmap()ed (rather than read) from the object */
+static hash_table_addr	sect_ro_map_tab;	/* Length of the mapping of each linked mmap()ed sect_ro_rel, keyed by address */
+static boolean_t	sect_ro_map_tab_init;
 static rhdtyp		*hdr;
 
 GBLREF mident_fixed	zlink_mname;
 GBLREF mach_inst	jsb_action[JSB_ACTION_N_INS];
 GBLREF uint4		ydbDebugLevel;
 GBLREF boolean_t	gtm_utf8_mode;
+GBLREF linkStats_t	linkStats;
+OS_PAGE_SIZE_DECLARE
 #ifdef DEBUG_ARLINK
 GBLREF mval		dollar_zsource;
 #endif
@@ -143,6 +152,7 @@ STATICFNDCL boolean_t	addr_fix(int file, unsigned char *shdr, linktype linktyp,
 STATICFNDCL void	zl_error(void *recent_zhist, linktype linktyp, int4 *file, int4 err, int4 len, char *addr,
 				 int4 len2, char *addr2);
 STATICFNDCL void	zl_error_hskpng(linktype linktyp, int4 *file, void *recent_zhist);
+STATICFNDCL unsigned char *link_map_sect_ro_rel(int file, ssize_t offset, int size);
 
 /* incr_link - read and process a mumps object module.  Link said module to currently executing image */
 #ifdef AUTORELINK_SUPPORTED
@@ -155,7 +165,8 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *f
 	rtn_tabent		*tabent_ptr;
 	int			sect_ro_rel_size, sect_rw_rel_size, name_buf_len, alloc_len, order, zerofd;
 	uint4			lcl_compiler_qlf;
-	boolean_t		dynlits;
+	boolean_t		dynlits, added;
+	ht_ent_addr		*tabent;
 	ssize_t	 		status, sect_rw_nonrel_size, sect_ro_rel_offset;
 	size_t			offset_correction, rtnname_off;
 	lab_tabent		*lbt_ent, *lbt_bot, *lbt_top, *olbt_ent, *olbt_bot, *olbt_top;
@@ -218,6 +229,7 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *f
 	hdr = NULL;
 	shdr = NULL;
 	sect_ro_rel = sect_rw_rel = sect_rw_nonrel = NULL;
+	sect_ro_map_len = 0;
 	if (*file_desc)
 	{	/* This is a disk resident object we share if autorelink is enabled in that directory, or instead we
 		 * read/link into process private storage if autorelink is not enabled.
@@ -581,12 +593,31 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *f
 			break;
 		case LINK_PPRIVOBJ:
 			sect_ro_rel_size = (unsigned int)((INTPTR_T)rw_rel_start - (INTPTR_T)hdr->ptext_adr);
-			sect_ro_rel = GTM_TEXT_ALLOC(sect_ro_rel_size);
-			/* R/O-release section should be aligned well at this point but make a debug level check to verify */
-			assert((INTPTR_T)sect_ro_rel == ((INTPTR_T)sect_ro_rel & ~(LINKAGE_PSECT_BOUNDARY - 1)));
-			DOREADRC_OBJFILE(*file_desc, sect_ro_rel, sect_ro_rel_size, status);
-			if (0 != status)
-				zl_error(NULL, linktyp, file_desc, ERR_INVOBJFILE, fname_len, fname, 0, NULL);
+			/* The read position of the object file is at the start of this section. If $ydb_link_mmap is set,
+			 * map the section (which is never modified once linked) straight from the object file instead of
+			 * reading it so every process running this object shares the same page cache pages for its code.
+			 * Objects are replaced by a rename rather than rewritten in place so the mapping stays stable.
+			 * The section can only be mapped if it keeps the alignment it would get from GTM_TEXT_ALLOC().
+			 * If anything stands in the way, fall back to reading it into process private storage.
+			 */
+			sect_ro_rel_offset = NATIVE_HDR_LEN + (ssize_t)hdr->ptext_adr;
+			if (TREF(link_mmap) && (0 == (sect_ro_rel_offset & (LINKAGE_PSECT_BOUNDARY - 1))))
+				sect_ro_rel = link_map_sect_ro_rel(*file_desc, sect_ro_rel_offset, sect_ro_rel_size);
+			if (NULL != sect_ro_rel)
+			{
+				linkStats.mapCnt++;
+				linkStats.mapBytes += sect_ro_rel_size;
+			} else
+			{
+				sect_ro_rel = GTM_TEXT_ALLOC(sect_ro_rel_size);
+				/* R/O-release section should be aligned well at this point but make a debug level check to verify */
+				assert((INTPTR_T)sect_ro_rel == ((INTPTR_T)sect_ro_rel & ~(LINKAGE_PSECT_BOUNDARY - 1)));
+				DOREADRC_OBJFILE(*file_desc, sect_ro_rel, sect_ro_rel_size, status);
+				if (0 != status)
+					zl_error(NULL, linktyp, file_desc, ERR_INVOBJFILE, fname_len, fname, 0, NULL);
+				linkStats.readCnt++;
+				linkStats.readBytes += sect_ro_rel_size;
+			}
 			/* The offset correction is the amount that needs to be applied to a given storage area that
 			 * is no longer contiguous with the routine header. In this case, the code and other sections
 			 * are no longer contiguous with the routine header but the initial offsets in the routine
@@ -625,7 +656,8 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *f
 			hdr->shared_ptext_adr = hdr->ptext_adr;
 			break;
 		case LINK_PPRIVOBJ:
-			hdr->shared_ptext_adr = NULL;
+			/* A mapped code section is read-only so ZBREAK must work on a private copy as for shared objects */
+			hdr->shared_ptext_adr = (0 != sect_ro_map_len) ? hdr->ptext_adr : NULL;
 			break;
 		default:
 			assert(FALSE /* Invalid link type */);
@@ -864,10 +896,21 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *f
 	DBGARLNK((stderr, "incr_link: (re)link for %.*s complete\n", hdr->routine_name.len, hdr->routine_name.addr));
 	/* zOS cleanups */
 	ZOS_FREE_TEXT_SECTION;
+	if (0 != sect_ro_map_len)
+	{	/* Remember how much was mapped so link_unmap_sect_ro_rel() can unmap exactly that when the routine goes away */
+		if (!sect_ro_map_tab_init)
+		{
+			init_hashtab_addr(&sect_ro_map_tab, 0, HASHTAB_NO_COMPACT, HASHTAB_NO_SPARE_TABLE);
+			sect_ro_map_tab_init = TRUE;
+		}
+		added = add_hashtab_addr(&sect_ro_map_tab, (char **)&sect_ro_rel, (void *)sect_ro_map_len, &tabent);
+		assert(added);
+	}
 	/* Don't leave global pointers around to active blocks */
 	hdr = NULL;
 	shdr = NULL;
 	sect_ro_rel = sect_rw_rel = sect_rw_nonrel = NULL;
+	sect_ro_map_len = 0;
 	return IL_DONE;
 }
 
@@ -1147,6 +1190,58 @@ STATICFNDEF void res_free(res_list *root)
 	}
 }
 
+/* Map the read-only releasable section of a process private object from the object file and advance the read position
+ * of the file past it as reading it would have. The mapping starts on the page holding the section so the returned
+ * address has the same offset within its page as the section has in the file.
+ *
+ * Parameters:
+ *   file   - file descriptor of the object file positioned at the start of the section.
+ *   offset - file offset of the section.
+ *   size   - size of the section.
+ *
+ * Returns the address of the section or NULL if it could not be mapped (caller reads it instead).
+ */
+STATICFNDEF unsigned char *link_map_sect_ro_rel(int file, ssize_t offset, int size)
+{
+	off_t		map_offset;
+	size_t		map_len;
+	void		*map_base;
+
+	map_offset = (off_t)ROUND_DOWN2(offset, OS_PAGE_SIZE);
+	map_len = (size_t)(offset - map_offset) + size;
+	map_base = mmap(NULL, map_len, PROT_READ | PROT_EXEC, MAP_PRIVATE, file, map_offset);
+	if (MAP_FAILED == map_base)
+		return NULL;
+	if (-1 == lseek(file, offset + size, SEEK_SET))
+	{
+		munmap(map_base, map_len);
+		return NULL;
+	}
+	sect_ro_map_len = map_len;
+	return (unsigned char *)map_base + (offset - map_offset);
+}
+
+/* Unmap the read-only releasable section of a process private object that link_map_sect_ro_rel() mapped (see
+ * RTN_TEXT_MAPPED) using the length recorded when it was linked.
+ *
+ * Parameters:
+ *   rhead - routine header of the object being unlinked.
+ */
+void link_unmap_sect_ro_rel(rhdtyp *rhead)
+{
+	unsigned char	*sect;
+	ht_ent_addr	*tabent;
+	size_t		map_len;
+
+	assert(RTN_TEXT_MAPPED(rhead));
+	sect = rhead->shared_ptext_adr;
+	tabent = sect_ro_map_tab_init ? (ht_ent_addr *)lookup_hashtab_addr(&sect_ro_map_tab, (char **)&sect) : NULL;
+	assertpro(NULL != tabent);
+	map_len = (size_t)tabent->value;
+	delete_hashtab_ent_addr(&sect_ro_map_tab, tabent);
+	munmap((void *)ROUND_DOWN2((UINTPTR_T)sect, OS_PAGE_SIZE), map_len);
+}
+
 /* Routine to perform cleanup and signal errors found in zlinking a mumps object module.
  *
  * Parameters:
@@ -1201,7 +1296,12 @@ STATICFNDEF void zl_error_hskpng(linktype linktyp, int4 *file, void *recent_zhis
 	}
 	if ((LINK_PPRIVOBJ == linktyp) && (NULL != sect_ro_rel))
 	{	/* Only private process links have this area to free */
-		GTM_TEXT_FREE(sect_ro_rel);
+		if (0 != sect_ro_map_len)
+		{
+			munmap((void *)ROUND_DOWN2((UINTPTR_T)sect_ro_rel, OS_PAGE_SIZE), sect_ro_map_len);
+			sect_ro_map_len = 0;
+		} else
+			GTM_TEXT_FREE(sect_ro_rel);
 		sect_ro_rel = NULL;
 	}
 	RELEASE_RECENT_ZHIST;
@@ -47,6 +47,15 @@ boolean_t incr_link(int *file_desc, zro_ent *zro_entry, zro_hist *recent_zhist_p
 boolean_t incr_link(int *file_desc, zro_ent *zro_entry, uint4 fname_len, char *fname);
 #endif
 
+/* A process private object linked with $ydb_link_mmap set has its read-only releasable section (code, line number table,
+ * literal text and linkage names - in that order) mmap()ed from the object file. It is the only kind of object not from a
+ * shared library or rtnobj shared memory that has shared_ptext_adr set. The mapping starts on the page holding the code
+ * and its length is recorded at link time for link_unmap_sect_ro_rel().
+ */
+#define RTN_TEXT_MAPPED(RHD) ((NULL != (RHD)->shared_ptext_adr) && (NULL == (RHD)->shlib_handle) && !(RHD)->shared_object)
+
+void link_unmap_sect_ro_rel(rhdtyp *rhead);
+
 #ifdef __MVS__
 #define ZOS_FREE_TEXT_SECTION 		\
 	if (NULL != text_section)	\
@@ -0,0 +1,529 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+#include "gtm_fcntl.h"
+
+#include "cdb_sc.h"
+#include "copy.h"
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gdsbml.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "gdscc.h"
+#include "gdskill.h"
+#include "jnl.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "hashtab_mname.h"
+#include "tp.h"
+#include "interlock.h"
+#include "iosp.h"		/* for SS_NORMAL */
+#include "min_max.h"
+#include "muextr.h"
+#include "mu_reorg.h"
+#include "mu_truncate.h"
+#include "repl_msg.h"		/* for gtmsource.h */
+#include "gtmsource.h"		/* for jnlpool_addrs_ptr_t */
+#include "sleep_cnt.h"
+
+/* Prototypes */
+#include "gtmmsg.h"		/* for gtm_putmsg prototype */
+#include "gvcst_bmp_mark_free.h"
+#include "gvcst_kill_sort.h"
+#include "gvcst_protos.h"	/* for gvcst_init, gvcst_search prototypes */
+#include "gvt_hashtab.h"
+#include "is_proc_alive.h"
+#include "mu_getlst.h"
+#include "mu_reorg_compact.h"
+#include "mupip_exit.h"
+#include "mupip_reorg.h"
+#include "t_abort.h"
+#include "t_begin.h"
+#include "t_end.h"
+#include "t_qread.h"
+#include "t_retry.h"
+#include "targ_alloc.h"
+#include "util.h"		/* for util_out_print prototype */
+#include "wcs_sleep.h"
+
+/* Number of local maps MUPIP REORG -COMPACT empties before truncating the file to give their space back */
+#define	COMPACT_TRUNC_LMAPS	64
+
+#define	LMAP_BLKS(LMAP_NUM, TOTAL_BLKS)	MIN((TOTAL_BLKS) - ((block_id)(LMAP_NUM) * BLKS_PER_LMAP), BLKS_PER_LMAP)
+
+/* mu_reorg_compact_blk return values */
+#define	COMPACT_MOVED		0	/* the block is now at a lower block number */
+#define	COMPACT_SKIPPED		1	/* not a block of any tree (just freed or being freed) or a block of a killed tree */
+#define	COMPACT_NOSPACE		2	/* there is no free block below it */
+
+GBLREF	bool			error_mupip;
+GBLREF	bool			mu_ctrlc_occurred;
+GBLREF	bool			mu_ctrly_occurred;
+GBLREF	boolean_t		mu_reorg_process;
+GBLREF	boolean_t		need_kip_incr;
+GBLREF	gd_region		*gv_cur_region;
+GBLREF	gv_key			*gv_altkey;
+GBLREF	gv_namehead		*gv_target;
+GBLREF	gv_namehead		*reorg_gv_target;
+GBLREF	inctn_opcode_t		inctn_opcode;
+GBLREF	sgmnt_addrs		*cs_addrs;
+GBLREF	sgmnt_addrs		*kip_csa;
+GBLREF	sgmnt_data_ptr_t	cs_data;
+GBLREF	tp_region		*grlist;
+GBLREF	uint4			process_id;
+GBLREF	uint4			update_trans;
+GBLREF	unsigned char		rdfail_detail;
+GBLREF	unsigned int		t_tries;
+
+error_def(ERR_MUNOACTION);
+error_def(ERR_MUNOFINISH);
+error_def(ERR_MUREORGFAIL);
+error_def(ERR_MUTRUNC1ATIME);
+error_def(ERR_MUTRUNCFAIL);
+error_def(ERR_MUTRUNCNOTBG);
+error_def(ERR_MUTRUNCNOV4);
+error_def(ERR_REORGCTRLY);
+
+STATICFNDCL int mu_reorg_compact_blk(block_id blk);
+STATICFNDCL boolean_t mu_reorg_compact_trunc(void);
+
+/* Moves block blk of the current region into the lowest numbered free block. The block is found in its tree the way
+ * mu_swap_blk finds its destination block: the first key of the leftmost data block under it names the global, whose
+ * directory tree path then either includes blk or leads to the root of the global variable tree that does. The parent
+ * is then pointed at the new location and blk freed, by swap_root_or_directory_block as MUPIP REORG -TRUNCATE does for
+ * root and directory tree blocks.
+ */
+STATICFNDEF int mu_reorg_compact_blk(block_id blk)
+{
+	block_id		child, free_blk_id, gvt_root;
+	boolean_t		is_dir, is_root, tn_aborted;
+	cache_rec_ptr_t		cr;
+	char			gname[MAX_MIDENT_LEN];
+	gv_namehead		*gvt;
+	ht_ent_mname		*tabent;
+	int			cycle, dir_level, key_len, key_len_dir, level, nslevel, rec_size;
+	kill_set		kill_set_list;
+	mname_entry		gvent;
+	node_local_ptr_t	cnl;
+	sgmnt_addrs		*csa;
+	sm_uc_ptr_t		blk_ptr, key_base, rec_base, tblk_ptr;
+	srch_hist		*dir_hist_ptr, *gvt_hist_ptr;
+	trans_num		curr_tn, ret_tn;
+	unsigned int		lcl_t_tries;
+	unsigned short		temp_ushort;
+	enum cdb_sc		status;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	csa = cs_addrs;
+	cnl = csa->nl;
+	if (NULL == TREF(gv_reorgkey))
+		GVKEY_INIT(TREF(gv_reorgkey), DBKEYSIZE(MAX_KEY_SZ));
+	t_begin(ERR_MUREORGFAIL, UPDTRNS_DB_UPDATED_MASK);
+	for (;;)
+	{
+		curr_tn = csa->ti->curr_tn;
+		kill_set_list.used = 0;
+		gv_target = csa->dir_tree;	/* until the global is known, so t_retry has no root search to redo */
+		if (NULL == (blk_ptr = t_qread(blk, (sm_int_ptr_t)&cycle, &cr)))
+		{
+			t_retry((enum cdb_sc)rdfail_detail);
+			continue;
+		}
+		level = ((blk_hdr_ptr_t)blk_ptr)->levl;
+		if ((MAX_BT_DEPTH <= level) || (SIZEOF(blk_hdr) >= ((blk_hdr_ptr_t)blk_ptr)->bsiz))
+		{	/* a bitmap or the empty leaf of a killed tree */
+			t_abort(gv_cur_region, csa);
+			return COMPACT_SKIPPED;
+		}
+		/* Follow *-records down to a block with a key to search */
+		nslevel = level;
+		tblk_ptr = blk_ptr;
+		rec_base = tblk_ptr + SIZEOF(blk_hdr);
+		GET_RSIZ(rec_size, rec_base);
+		while ((BSTAR_REC_SIZE == rec_size) && (0 != nslevel))
+		{
+			GET_LONG(child, (rec_base + SIZEOF(rec_hdr)));
+			if ((0 == child) || (child > csa->ti->total_blks - 1))
+				break;
+			if (NULL == (tblk_ptr = t_qread(child, (sm_int_ptr_t)&cycle, &cr)))
+				break;
+			if (SIZEOF(blk_hdr) >= ((blk_hdr_ptr_t)tblk_ptr)->bsiz)
+				break;
+			nslevel--;
+			rec_base = tblk_ptr + SIZEOF(blk_hdr);
+			GET_RSIZ(rec_size, rec_base);
+		}
+		if ((NULL == tblk_ptr) || (SIZEOF(blk_hdr) >= ((blk_hdr_ptr_t)tblk_ptr)->bsiz) || (BSTAR_REC_SIZE == rec_size))
+		{
+			t_abort(gv_cur_region, csa);
+			return COMPACT_SKIPPED;
+		}
+		key_len_dir = get_gblname_len(tblk_ptr, rec_base + SIZEOF(rec_hdr));
+		key_len = get_key_len(tblk_ptr, rec_base + SIZEOF(rec_hdr));
+		if ((1 >= key_len_dir) || (MAX_MIDENT_LEN + 1 < key_len_dir) || (2 >= key_len) || (MAX_KEY_SZ < key_len))
+		{	/* Just freed and still marked busy, or being changed under us */
+			if (CDB_STAGNATE <= t_tries)
+			{
+				t_abort(gv_cur_region, csa);
+				return COMPACT_SKIPPED;
+			}
+			t_retry(cdb_sc_blkmod);
+			continue;
+		}
+		memcpy(gname, rec_base + SIZEOF(rec_hdr), key_len_dir - 1);
+		memcpy(&((TREF(gv_reorgkey))->base[0]), rec_base + SIZEOF(rec_hdr), key_len);
+		(TREF(gv_reorgkey))->end = key_len - 1;
+		gvent.var_name.addr = gname;
+		gvent.var_name.len = key_len_dir - 1;
+		COMPUTE_HASH_MNAME(&gvent);
+		if (NULL != (tabent = lookup_hashtab_mname(csa->gvt_hashtab, &gvent)))
+			gvt = (gv_namehead *)tabent->value;
+		else
+			gvt = targ_alloc(csa->hdr->max_key_size, &gvent, gv_cur_region);
+		gv_target = gvt;
+		reorg_gv_target->gvname.var_name = gvt->gvname.var_name;	/* needed by SAVE_ROOTSRCH_ENTRY_STATE */
+		SET_GV_CURRKEY_FROM_GVT(gvt);
+		SET_GV_ALTKEY_TO_GBLNAME_FROM_GV_CURRKEY;
+		dir_hist_ptr = gvt->alt_hist;
+		gvt_hist_ptr = &gvt->hist;
+		/* Directory tree path of the global */
+		gvt->root = csa->dir_tree->root;
+		gvt->clue.end = 0;
+		status = gvcst_search(gv_altkey, dir_hist_ptr);
+		gvt->root = 0;
+		if (cdb_sc_normal != status)
+		{
+			t_retry(status);
+			continue;
+		}
+		if (dir_hist_ptr->h[0].curr_rec.match != gv_altkey->end + 1)
+		{	/* no such global (any more) */
+			t_abort(gv_cur_region, csa);
+			return COMPACT_SKIPPED;
+		}
+		key_base = dir_hist_ptr->h[0].buffaddr + dir_hist_ptr->h[0].curr_rec.offset + SIZEOF(rec_hdr);
+		GET_LONG(gvt_root, key_base + get_key_len(dir_hist_ptr->h[0].buffaddr, key_base));
+		if ((0 == gvt_root) || (gvt_root > csa->ti->total_blks - 1))
+		{
+			t_retry(cdb_sc_blkmod);
+			continue;
+		}
+		gvt->root = gvt_root;
+		for (dir_level = 0; (dir_level < dir_hist_ptr->depth) && (dir_hist_ptr->h[dir_level].blk_num != blk); dir_level++)
+			;
+		is_dir = (dir_level < dir_hist_ptr->depth);	/* the root, block 1, is never at the end of the file */
+		is_root = FALSE;
+		if (is_dir)
+			free_blk_id = swap_root_or_directory_block(dir_level + 1, dir_level, dir_hist_ptr, blk, blk_ptr,
+					&kill_set_list, curr_tn);
+		else
+		{	/* A global variable tree block */
+			gvt->clue.end = 0;
+			if (cdb_sc_normal != (status = gvcst_search(TREF(gv_reorgkey), NULL)))
+			{
+				t_retry(status);
+				continue;
+			}
+			if ((level > gvt_hist_ptr->depth) || (gvt_hist_ptr->h[level].blk_num != blk))
+			{	/* not (any more) in the tree; probably in the kill set of another process */
+				t_abort(gv_cur_region, csa);
+				return COMPACT_SKIPPED;
+			}
+			is_root = (level == gvt_hist_ptr->depth);
+			if (is_root)
+				free_blk_id = swap_root_or_directory_block(0, level, dir_hist_ptr, blk, blk_ptr, &kill_set_list,
+						curr_tn);
+			else
+				free_blk_id = swap_root_or_directory_block(level + 1, level, gvt_hist_ptr, blk, blk_ptr,
+						&kill_set_list, curr_tn);
+		}
+		if (RETRY_SWAP == free_blk_id)
+			continue;
+		else if (ABORT_SWAP == free_blk_id)
+			return COMPACT_NOSPACE;
+		if (is_dir && (0 == dir_level))
+			/* Mark the kill set as that of a level-0 directory tree block, as mu_swap_root does */
+			kill_set_list.blk[kill_set_list.used - 1].level = 1;
+		update_trans = UPDTRNS_DB_UPDATED_MASK;
+		inctn_opcode = inctn_mu_reorg;
+		assert(1 == kill_set_list.used);
+		need_kip_incr = TRUE;
+		if (!csa->now_crit)
+			WAIT_ON_INHIBIT_KILLS(cnl, MAXWAIT2KILL);
+		DEBUG_ONLY(lcl_t_tries = t_tries);
+		if (is_dir)
+		{
+			TREF(in_mu_swap_root_state) = MUSWP_DIRECTORY_SWAP;
+			ret_tn = t_end(dir_hist_ptr, NULL, TN_NOT_SPECIFIED);
+		} else if (is_root)
+		{
+			TREF(in_mu_swap_root_state) = MUSWP_INCR_ROOT_CYCLE;
+			ret_tn = t_end(gvt_hist_ptr, dir_hist_ptr, TN_NOT_SPECIFIED);
+		} else
+			ret_tn = t_end(gvt_hist_ptr, NULL, TN_NOT_SPECIFIED);
+		TREF(in_mu_swap_root_state) = MUSWP_NONE;
+		if ((trans_num)0 == ret_tn)
+		{
+			need_kip_incr = FALSE;
+			assert(NULL == kip_csa);
+			if (is_root)
+			{
+				ABORT_TRANS_IF_GBL_EXIST_NOMORE(lcl_t_tries, tn_aborted);
+				if (tn_aborted)
+					return COMPACT_SKIPPED;
+			}
+			continue;
+		}
+		gvcst_kill_sort(&kill_set_list);
+		if (kill_set_list.blk[0].level)
+			TREF(in_mu_swap_root_state) = MUSWP_FREE_BLK;
+		GVCST_BMP_MARK_FREE(&kill_set_list, ret_tn, inctn_mu_reorg, inctn_bmp_mark_free_mu_reorg, inctn_opcode, csa);
+		TREF(in_mu_swap_root_state) = MUSWP_NONE;
+		DECR_KIP(cs_data, csa, kip_csa);
+		return COMPACT_MOVED;
+	}
+}
+
+/* Gives the space at the end of the file back with mu_truncate. Returns FALSE only if mu_truncate failed. */
+STATICFNDEF boolean_t mu_reorg_compact_trunc(void)
+{
+	boolean_t	truncated;
+
+	grab_crit(gv_cur_region);
+	cs_addrs->nl->highest_lbm_with_busy_blk = 0;
+	rel_crit(gv_cur_region);
+	mu_reorg_process = FALSE;
+	truncated = mu_truncate(0);
+	mu_reorg_process = TRUE;
+	return truncated;
+}
+
+/* MUPIP REORG -COMPACT -REGION <region-list>
+ *
+ * Shrinks the database file of each region, online, in one pass. A scan of all local bitmaps counts the busy blocks in each
+ * local map and plans how many local maps, starting at the beginning of the file, have enough free blocks to take every
+ * busy block of the ones after them. Then, working from the last local map back to the first one beyond that point, every
+ * busy block of a local map is moved into the lowest free block (see mu_reorg_compact_blk), after asking the OS to read the
+ * whole local map in one sequential read. Each time COMPACT_TRUNC_LMAPS local maps have been emptied, mu_truncate cuts them
+ * off the file, so the space comes back while the compaction runs and an interrupted run keeps what it already reclaimed.
+ * Unlike MUPIP REORG -TRUNCATE, no block is swapped with one it does not need to move and no global is walked in key order.
+ * Honors the region's REORG_SLEEP_NSEC after every local map.
+ */
+void	mu_reorg_compact(void)
+{
+	block_id		lmap_blk_num;
+	boolean_t		nospace;
+	cache_rec_ptr_t		cr;
+	gd_region		*reg;
+	gtm_uint64_t		busy_above, free_below;
+	int			blks_in_lmap, bml_status, cycle, emptied, keep, lmap_num, num_local_maps, ret;
+	int4			idx, status;
+	node_local_ptr_t	cnl;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	sm_uc_ptr_t		bml_ptr;
+	tp_region		*rptr;
+	uint4			*lmap_free, lcl_pid, moved, skipped, sleep_nsec, total_blks;
+	unix_db_info		*udi;
+	unsigned char		bml[BM_MINUS_BLKHDR_SIZE(BLKS_PER_LMAP)];
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	status = SS_NORMAL;
+	error_mupip = FALSE;
+	gvinit();	/* initialize gd_header (needed by the later call to mu_getlst) */
+	mu_getlst("REG_NAME", SIZEOF(tp_region)); /* get the parm for the REGION qualifier */
+	if (error_mupip)
+	{
+		util_out_print("!/MUPIP REORG -COMPACT cannot proceed with above errors!/", TRUE);
+		mupip_exit(ERR_MUNOACTION);
+	}
+	GVKEYSIZE_INIT_IF_NEEDED;	/* sets "gv_keysize", "gv_currkey" and "gv_altkey" (if not already done) */
+	if (NULL == reorg_gv_target)
+		reorg_gv_target = targ_alloc(MAX_KEY_SZ, NULL, NULL);
+	for (rptr = grlist;  NULL != rptr;  rptr = rptr->fPtr)
+	{
+		if (mu_ctrly_occurred || mu_ctrlc_occurred)
+			break;
+		reg = rptr->reg;
+		if (reg_cmcheck(reg))
+		{
+			util_out_print("Region !AD : MUPIP REORG -COMPACT cannot run across network", TRUE, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		gvcst_init(reg);
+		if (reg->was_open)	/* Already open under another name.  Region will not be marked open */
+		{
+			reg->open = FALSE;
+			util_out_print("Region !AD : is already open under another name", TRUE, REG_LEN_STR(reg));
+			continue;
+		}
+		if (reg->read_only)
+		{
+			util_out_print("Region !AD : MUPIP REORG -COMPACT cannot run on a read-only database", TRUE, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		TP_CHANGE_REG(reg);	/* sets gv_cur_region, cs_addrs, cs_data */
+		csa = cs_addrs;
+		csd = cs_data;
+		cnl = csa->nl;
+		udi = FILE_INFO(reg);
+		if (dba_bg != csd->acc_meth)
+		{
+			gtm_putmsg_csa(CSA_ARG(csa) VARLSTCNT(4) ERR_MUTRUNCNOTBG, 2, REG_LEN_STR(reg));
+			continue;
+		}
+		if ((GDSVCURR != csd->desired_db_format) || (0 != csd->blks_to_upgrd))
+		{
+			gtm_putmsg_csa(CSA_ARG(csa) VARLSTCNT(4) ERR_MUTRUNCNOV4, 2, REG_LEN_STR(reg));
+			continue;
+		}
+		if (NULL == csa->gvt_hashtab)
+			gvt_hashtab_init(csa);	/* lets mu_reorg_compact_blk find the gv_target of a global it met before */
+		/* Ensure only one truncate process at a time operates on given region */
+		grab_crit(reg);
+		lcl_pid = cnl->trunc_pid;
+		if (lcl_pid && is_proc_alive(lcl_pid, 0))
+		{
+			rel_crit(reg);
+			gtm_putmsg_csa(CSA_ARG(csa) VARLSTCNT(5) ERR_MUTRUNC1ATIME, 3, lcl_pid, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		cnl->trunc_pid = process_id;
+		cnl->highest_lbm_with_busy_blk = 0;
+		rel_crit(reg);
+		mu_reorg_process = TRUE;
+		/* Plan: count the free (or recycled) blocks of every local map */
+		total_blks = csa->ti->total_blks;
+		num_local_maps = DIVIDE_ROUND_UP(total_blks, BLKS_PER_LMAP);
+		lmap_free = (uint4 *)malloc(SIZEOF(uint4) * num_local_maps);
+		for (lmap_num = 0; lmap_num < num_local_maps; lmap_num++)
+		{
+			lmap_blk_num = (block_id)lmap_num * BLKS_PER_LMAP;
+			blks_in_lmap = LMAP_BLKS(lmap_num, total_blks);
+			lmap_free[lmap_num] = 0;
+			t_begin(ERR_MUREORGFAIL, 0);
+			bml_ptr = t_qread(lmap_blk_num, (sm_int_ptr_t)&cycle, &cr);
+			if ((NULL != bml_ptr) && (BM_SIZE(BLKS_PER_LMAP) == ((blk_hdr_ptr_t)bml_ptr)->bsiz))
+			{	/* An unreadable map counts as full; the plan need only be close */
+				for (idx = 1; idx < blks_in_lmap; idx++)
+				{
+					GET_STATUS(bml_ptr[SIZEOF(blk_hdr) + (idx / BML_BLKS_PER_UCHAR)], (idx % BML_BLKS_PER_UCHAR),
+						bml_status);
+					if (BLK_BUSY != bml_status)
+						lmap_free[lmap_num]++;
+				}
+			}
+			t_abort(reg, csa);
+		}
+		/* keep is the first local map whose busy blocks, with those of all local maps after it, fit in the free blocks
+		 * of the local maps before it.
+		 */
+		for (busy_above = 0, lmap_num = 1; lmap_num < num_local_maps; lmap_num++)
+			busy_above += LMAP_BLKS(lmap_num, total_blks) - 1 - lmap_free[lmap_num];
+		for (free_below = 0, keep = 1; keep < num_local_maps; keep++)
+		{
+			free_below += lmap_free[keep - 1];
+			if (free_below >= busy_above)
+				break;
+			busy_above -= LMAP_BLKS(keep, total_blks) - 1 - lmap_free[keep];
+		}
+		free(lmap_free);
+		util_out_print("Region !AD : Compacting !UL blocks into !UL", TRUE, REG_LEN_STR(reg), total_blks,
+			(uint4)MIN(total_blks, (gtm_uint64_t)keep * BLKS_PER_LMAP));
+		/* Move: empty the local maps from the end of the file back to keep */
+		moved = skipped = 0;
+		emptied = 0;
+		nospace = FALSE;
+		for (lmap_num = num_local_maps - 1; (lmap_num >= keep) && !nospace; lmap_num--)
+		{
+			if (mu_ctrly_occurred || mu_ctrlc_occurred)
+				break;
+			total_blks = csa->ti->total_blks;
+			lmap_blk_num = (block_id)lmap_num * BLKS_PER_LMAP;
+			if (lmap_blk_num >= total_blks)
+				continue;	/* already truncated */
+			blks_in_lmap = LMAP_BLKS(lmap_num, total_blks);
+#			ifdef POSIX_FADV_WILLNEED
+			(void)posix_fadvise(udi->fd, BLK_ZERO_OFF(csd->start_vbn) + ((off_t)lmap_blk_num * csd->blk_size),
+				(off_t)blks_in_lmap * csd->blk_size, POSIX_FADV_WILLNEED);
+#			endif
+			t_begin(ERR_MUREORGFAIL, 0);
+			bml_ptr = t_qread(lmap_blk_num, (sm_int_ptr_t)&cycle, &cr);
+			if ((NULL == bml_ptr) || (BM_SIZE(BLKS_PER_LMAP) != ((blk_hdr_ptr_t)bml_ptr)->bsiz))
+			{
+				t_abort(reg, csa);
+				continue;
+			}
+			memcpy(bml, bml_ptr + SIZEOF(blk_hdr), SIZEOF(bml));
+			t_abort(reg, csa);
+			for (idx = 1; idx < blks_in_lmap; idx++)
+			{
+				if (mu_ctrly_occurred || mu_ctrlc_occurred)
+					break;
+				GET_STATUS(bml[idx / BML_BLKS_PER_UCHAR], (idx % BML_BLKS_PER_UCHAR), bml_status);
+				if (BLK_BUSY != bml_status)
+					continue;
+				ret = mu_reorg_compact_blk(lmap_blk_num + idx);
+				if (COMPACT_MOVED == ret)
+					moved++;
+				else if (COMPACT_SKIPPED == ret)
+					skipped++;
+				else
+				{
+					assert(COMPACT_NOSPACE == ret);
+					nospace = TRUE;
+					break;
+				}
+			}
+			if ((COMPACT_TRUNC_LMAPS <= ++emptied) && !nospace)
+			{
+				if (!mu_reorg_compact_trunc())
+					mupip_exit(ERR_MUTRUNCFAIL);
+				emptied = 0;
+			}
+			sleep_nsec = csd->reorg_sleep_nsec;
+			if (sleep_nsec)
+				NANOSLEEP(sleep_nsec, RESTART_TRUE);
+		}
+		util_out_print("Region !AD : Moved !UL blocks, skipped !UL blocks of killed or changing trees", TRUE,
+			REG_LEN_STR(reg), moved, skipped);
+		if (nospace)
+			util_out_print("Region !AD : No free block below the remaining blocks; compaction ended early", TRUE,
+				REG_LEN_STR(reg));
+		if (!mu_ctrly_occurred && !mu_ctrlc_occurred && !mu_reorg_compact_trunc())
+			mupip_exit(ERR_MUTRUNCFAIL);
+		mu_reorg_process = FALSE;
+		grab_crit(reg);
+		assert(cnl->trunc_pid == process_id);
+		cnl->trunc_pid = 0;
+		rel_crit(reg);
+	}
+	if (mu_ctrly_occurred || mu_ctrlc_occurred)
+	{
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(1) ERR_REORGCTRLY);
+		status = ERR_MUNOFINISH;
+	}
+	mupip_exit(status);
+}
@@ -0,0 +1,21 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef MU_REORG_COMPACT_DEFINED
+
+/* prototypes */
+
+void	mu_reorg_compact(void);
+
+#define MU_REORG_COMPACT_DEFINED
+
+#endif
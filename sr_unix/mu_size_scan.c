@@ -16,6 +16,8 @@
 #include "mdef.h"
 
 #include "gtm_string.h"
+#include "gtm_stdio.h"
+#include "gtm_stdlib.h"
 
 #include "cdb_sc.h"
 #include "gdsroot.h"
@@ -55,6 +57,8 @@
 #include "longset.h"            /* needed for cws_insert.h */
 #include "hashtab_int4.h"
 #include "cws_insert.h"
+#include "min_max.h"
+#include "gtm_multi_proc.h"
 #include <math.h>
 
 error_def(ERR_GBLNOEXIST);
@@ -68,27 +72,70 @@ GBLREF	uint4			process_id;
 GBLREF	inctn_opcode_t          inctn_opcode;
 GBLREF	unsigned char           rdfail_detail;
 GBLREF	uint4			mu_int_adj[];
+GBLREF	block_id		mu_int_adj_prev[];
 GBLREF	sgmnt_addrs		*cs_addrs;
 GBLREF	sgmnt_data_ptr_t	cs_data;
 GBLREF	unsigned int		t_tries;
 
+#define ANY_ROOT_LEVL		(MAX_BT_DEPTH + 5)	/* overload invalid level value */
+#define	MAX_SCANS		200000000		/* catch infinite loops */
+#define	SIZE_FILL_BUCKETS	10			/* buckets of the fill factor histogram, each 10 percent wide */
+#define	SIZE_TASKS_PER_WORKER	8			/* subtrees per -PARALLEL worker, so faster workers pick up the slack */
+
+/* Per level totals of the blocks counted by a HEURISTIC=SCAN. A -PARALLEL worker leaves the totals of each of its subtrees
+ * in a slot of the gtm_multi_proc shared memory for the parent to add up.
+ */
+typedef struct
+{
+	gtm_uint64_t	blks[MAX_BT_DEPTH + 1];
+	gtm_uint64_t	recs[MAX_BT_DEPTH + 1];
+	gtm_uint64_t	bytes[MAX_BT_DEPTH + 1];
+	gtm_uint64_t	fill[MAX_BT_DEPTH + 1][SIZE_FILL_BUCKETS];
+	uint4		adj[MAX_BT_DEPTH + 1];
+} size_stats_t;
+
+typedef struct
+{
+	block_id	blk;
+	int		levl;
+} size_node_t;
+
+typedef struct
+{
+	block_id	blk;		/* top block of the subtree scanned by the task */
+	int		levl;		/* level blk was at when the subtree was split off */
+	int		index;		/* slot of the task in the shared memory statistics */
+	unsigned char	key[MAX_MIDENT_LEN + 32];	/* "<global> subtree <n>", the prefix of the worker's output lines */
+} size_task_t;
+
 STATICDEF	int		targ_levl;
 STATICDEF	uint4		total_recs, total_scans;
 STATICDEF	INTPTR_T	saveoff[MAX_BT_DEPTH + 1];
+STATICDEF	size_stats_t	size_stats;
+STATICDEF	size_stats_t	*size_shm_stats;
 
 STATICFNDCL enum cdb_sc dfs(int lvl, sm_uc_ptr_t pBlkBase, boolean_t endtree, boolean_t skiprecs);
 STATICFNDCL enum cdb_sc read_block(block_id nBlkId, sm_uc_ptr_t *pBlkBase_ptr, int *nLevl_ptr, int desired_levl);
+STATICFNDCL void size_count_blk(int lvl, uint4 bsiz, int4 rCnt);
+STATICFNDCL int mu_size_scan_tree(block_id top_blk, int top_levl);
+STATICFNDCL int mu_size_scan_split(block_id blk, int levl, size_node_t *child, int *nchild_ptr);
+STATICFNDCL int mu_size_scan_parallel(glist *gl_ptr, int root_levl, int nworkers);
+STATICFNDCL int mu_size_scan_worker(size_task_t *task);
+STATICFNDCL int mu_size_scan_init(size_task_t *task);
+STATICFNDCL int mu_size_scan_finish(size_task_t *task);
+STATICFNDCL void mu_size_scan_report(int root_levl);
 
-#define ANY_ROOT_LEVL		(MAX_BT_DEPTH + 5)	/* overload invalid level value */
-#define	MAX_SCANS		200000000		/* catch infinite loops */
-
-int4 mu_size_scan(glist *gl_ptr, int4 level)
+/* HEURISTIC=SCAN counts the blocks and records of the global at the given level, validating every path from the root (for
+ * -PARALLEL workers, every path from the top of their subtree; see the caveat in mu_size_scan_parallel).
+ * With HEURISTIC=PARALLEL=n (nworkers), it also reports the blocks, records and bytes of every level from the root down to that
+ * one along with a histogram of how full their blocks are, and if n is more than 1, n processes forked off by gtm_multi_proc
+ * scan the subtrees below the top levels (see mu_size_scan_parallel). nworkers is 0 without PARALLEL.
+ */
+int4 mu_size_scan(glist *gl_ptr, int4 level, int4 nworkers)
 {
-	block_id		nBlkId;
-	boolean_t		equal, tn_aborted, verify_reads;
+	boolean_t		tn_aborted;
 	enum cdb_sc		status;
-	trans_num		ret_tn;
-	int			h, i, k;
+	int			k, root_levl, ret;
 	int4			nLevl;
 	sm_uc_ptr_t		pBlkBase;
 	unsigned int		lcl_t_tries;
@@ -105,9 +152,12 @@ int4 mu_size_scan(glist *gl_ptr, int4 level)
 	}
 	gv_target->alt_hist->depth = MAX_BT_DEPTH;	/* initialize: don't copy to saveoff if restart before a single success */
 	total_recs = total_scans = 0;
+	memset(&size_stats, 0, SIZEOF(size_stats));
 	for (k = 0; k <= MAX_BT_DEPTH; k++)
 	{
 		saveoff[k] = 0;
+		mu_int_adj[k] = 0;
+		mu_int_adj_prev[k] = 0;
 		gv_target->hist.h[k].cr = NULL;		/* initialize for optimization in read_block which bumps cr refer bits */
 	}
 	targ_levl = 0;
@@ -145,13 +195,56 @@ int4 mu_size_scan(glist *gl_ptr, int4 level)
 		return EXIT_ERR;
 	}
 	targ_levl = level;
-	/* Run the dfs down to targ_levl to count records and blocks. Validate every path from root to blocks at targ_levl */
+	root_levl = nLevl;
+	if ((1 < nworkers) && ((targ_levl + 1) < root_levl))
+		ret = mu_size_scan_parallel(gl_ptr, root_levl, nworkers);
+	else
+		ret = mu_size_scan_tree(gv_target->root, ANY_ROOT_LEVL);
+	if (ERR_GBLNOEXIST == ret)
+	{	/* Global does not exist (online rollback). Not an error. */
+		gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_GBLNOEXIST, 2, GNAME(gl_ptr).len, GNAME(gl_ptr).addr);
+		return EXIT_NRM;
+	}
+	if (0 != ret)
+		return EXIT_ERR;
+	util_out_print("Level          Blocks          Records         Adjacent", FLUSH);
+	util_out_print("!5UL !15UL !16UL !16UL", FLUSH, level, total_scans, total_recs, mu_int_adj[level ? level : 1]);
+	if (nworkers)
+		mu_size_scan_report(root_levl);
+	if (mu_ctrlc_occurred || mu_ctrly_occurred)
+		return EXIT_ERR;
+	return EXIT_NRM;
+}
+
+/* Runs the dfs from top_blk (the root, or the top of a subtree for a -PARALLEL worker) down to targ_levl to count records and
+ * blocks, validating every path from top_blk to blocks at targ_levl. top_levl is ANY_ROOT_LEVL for the root, otherwise the
+ * level top_blk must still be at. Nothing above top_blk is validated for a worker, see the caveat in mu_size_scan_parallel.
+ * Returns ERR_GBLNOEXIST if an online rollback removed the global and 0 otherwise.
+ */
+STATICFNDEF int mu_size_scan_tree(block_id top_blk, int top_levl)
+{
+	boolean_t		tn_aborted;
+	enum cdb_sc		status;
+	int			i, k;
+	int4			nLevl;
+	sm_uc_ptr_t		pBlkBase;
+	unsigned int		lcl_t_tries;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	gv_target->alt_hist->depth = MAX_BT_DEPTH;	/* initialize: don't copy to saveoff if restart before a single success */
+	for (k = 0; k <= MAX_BT_DEPTH; k++)
+	{
+		saveoff[k] = 0;
+		gv_target->hist.h[k].cr = NULL;		/* initialize for optimization in read_block which bumps cr refer bits */
+	}
 	t_begin(ERR_MUSIZEFAIL, 0);
 	for (;;)
 	{	/* retry loop. note that multiple successful read transactions can occur within a single iteration */
-		nBlkId = gv_target->root;
 		nLevl = ANY_ROOT_LEVL;
-		status = read_block(nBlkId, &pBlkBase, &nLevl, ANY_ROOT_LEVL);
+		status = read_block(top_blk, &pBlkBase, &nLevl, ANY_ROOT_LEVL);
+		if ((cdb_sc_normal == status) && (ANY_ROOT_LEVL != top_levl) && (nLevl != top_levl))
+			status = cdb_sc_badlvl;	/* subtree top was freed and reused; fails with MUSIZEFAIL if it persists */
 		if (cdb_sc_normal == status)
 			status = dfs(nLevl, pBlkBase, TRUE, TRUE);
 		if (cdb_sc_endtree != status)
@@ -162,10 +255,7 @@ int4 mu_size_scan(glist *gl_ptr, int4 level)
 			lcl_t_tries = TREF(prev_t_tries);
 			ABORT_TRANS_IF_GBL_EXIST_NOMORE(lcl_t_tries, tn_aborted);
 			if (tn_aborted)
-			{	/* Global does not exist (online rollback). Not an error. */
-				gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_GBLNOEXIST, 2, GNAME(gl_ptr).len, GNAME(gl_ptr).addr);
-				return EXIT_NRM;
-			}
+				return ERR_GBLNOEXIST;
 			/* update saveoff */
 			if (gv_target->alt_hist->depth < MAX_BT_DEPTH)
 			{
@@ -176,11 +266,235 @@ int4 mu_size_scan(glist *gl_ptr, int4 level)
 		}
 		break;
 	}
-	util_out_print("Level          Blocks          Records         Adjacent", FLUSH);
-	util_out_print("!5UL !15UL !16UL !16UL", FLUSH, level, total_scans, total_recs, mu_int_adj[level ? level : 1]);
-	if (mu_ctrlc_occurred || mu_ctrly_occurred)
-		return EXIT_ERR;
-	return EXIT_NRM;
+	return 0;
+}
+
+/* Reads the index block blk at level levl in a transaction of its own, counts it and returns the blocks its records point to
+ * in child[] (which has room for MAX_RECS_PER_BLK) and their number in *nchild_ptr. Returns ERR_GBLNOEXIST if an online
+ * rollback removed the global and 0 otherwise.
+ */
+STATICFNDEF int mu_size_scan_split(block_id blk, int levl, size_node_t *child, int *nchild_ptr)
+{
+	block_id		nBlkId;
+	boolean_t		tn_aborted;
+	enum cdb_sc		status;
+	int4			nLevl, rCnt;
+	sm_uc_ptr_t		pBlkBase, pRec, pTop;
+	srch_hist		blkhist;
+	uint4			bsiz;
+	unsigned int		lcl_t_tries;
+	unsigned short		nRecLen;
+	DCL_THREADGBL_ACCESS;
+
+	SETUP_THREADGBL_ACCESS;
+	assert(targ_levl < levl);
+	t_begin(ERR_MUSIZEFAIL, 0);
+	for (;;)
+	{	/* retry loop */
+		status = read_block(blk, &pBlkBase, &nLevl, levl);
+		if (cdb_sc_normal == status)
+		{
+			bsiz = ((blk_hdr_ptr_t)pBlkBase)->bsiz;
+			BLK_LOOP(rCnt, pRec, pBlkBase, pTop, nRecLen)
+			{
+				GET_AND_CHECK_RECLEN(status, nRecLen, pRec, pTop, nBlkId);
+				if (cdb_sc_normal != status)
+				{
+					assert(CDB_STAGNATE > t_tries);
+					break;
+				}
+				child[rCnt].blk = nBlkId;
+				child[rCnt].levl = levl - 1;
+			}
+		}
+		if (cdb_sc_normal != status)
+		{
+			t_retry(status);
+			continue;
+		}
+		memcpy(&blkhist.h[0], &gv_target->hist.h[levl - targ_levl], SIZEOF(srch_blk_status));
+		blkhist.h[1].blk_num = 0;
+		if ((trans_num)0 == t_end(&blkhist, NULL, TN_NOT_SPECIFIED))
+		{
+			lcl_t_tries = TREF(prev_t_tries);
+			ABORT_TRANS_IF_GBL_EXIST_NOMORE(lcl_t_tries, tn_aborted);
+			if (tn_aborted)
+				return ERR_GBLNOEXIST;
+			continue;
+		}
+		break;
+	}
+	size_count_blk(levl, bsiz, rCnt);
+	*nchild_ptr = rCnt;
+	return 0;
+}
+
+/* Splits the global into about nworkers * SIZE_TASKS_PER_WORKER subtrees by reading its top levels breadth first in this
+ * process (only index blocks above targ_levl + 1 are split, so every subtree has something below its top block to scan),
+ * and has gtm_multi_proc run mu_size_scan_tree on each subtree in up to nworkers processes. A worker that is done with a
+ * subtree takes the next, so a skewed global does not leave the other workers idle. The subtrees are fixed before the
+ * workers start, so updates that split a block above them in the meantime can have the counts miss or repeat the blocks
+ * involved; on a database without concurrent updates the counts are exact. A worker checks that the top block of its subtree
+ * is still at the level it was split off at (a block freed and reused at another level fails the scan with MUSIZEFAIL
+ * rather than being counted), but cannot tell if it was reused at the same level elsewhere.
+ */
+STATICFNDEF int mu_size_scan_parallel(glist *gl_ptr, int root_levl, int nworkers)
+{
+	int		head, idx, nchild, ntasks, qsize, status, tail, target;
+	mstr		*gn;
+	size_node_t	*queue;
+	size_task_t	*tasks;
+	void		**ret_array;
+
+	target = nworkers * SIZE_TASKS_PER_WORKER;
+	qsize = target + (2 * MAX_RECS_PER_BLK);
+	queue = (size_node_t *)malloc(SIZEOF(size_node_t) * qsize);
+	queue[0].blk = gv_target->root;
+	queue[0].levl = root_levl;
+	head = 0;
+	tail = 1;
+	status = 0;
+	/* Blocks are split in level order, so the one at the head of the queue is always of the highest level in it */
+	while (((tail - head) < target) && ((targ_levl + 1) < queue[head].levl) && !mu_ctrlc_occurred && !mu_ctrly_occurred)
+	{
+		if (qsize < (tail + MAX_RECS_PER_BLK))
+		{
+			memmove(queue, &queue[head], SIZEOF(size_node_t) * (tail - head));
+			tail -= head;
+			head = 0;
+		}
+		status = mu_size_scan_split(queue[head].blk, queue[head].levl, &queue[tail], &nchild);
+		if (0 != status)
+			break;
+		head++;
+		tail += nchild;
+	}
+	ntasks = tail - head;
+	if ((0 == status) && (1 < ntasks))
+	{
+		gn = &GNAME(gl_ptr);
+		tasks = (size_task_t *)malloc(SIZEOF(size_task_t) * ntasks);
+		ret_array = (void **)malloc(SIZEOF(void *) * ntasks);
+		for (idx = 0; idx < ntasks; idx++)
+		{
+			tasks[idx].blk = queue[head + idx].blk;
+			tasks[idx].levl = queue[head + idx].levl;
+			tasks[idx].index = idx;
+			SNPRINTF((char *)tasks[idx].key, SIZEOF(tasks[idx].key), "%.*s subtree %d", gn->len, gn->addr, idx + 1);
+		}
+		status = gtm_multi_proc((gtm_multi_proc_fnptr_t)&mu_size_scan_worker, ntasks, nworkers, ret_array, (void *)tasks,
+					SIZEOF(size_task_t), SIZEOF(size_stats_t) * ntasks,
+					(gtm_multi_proc_fnptr_t)&mu_size_scan_init, (gtm_multi_proc_fnptr_t)&mu_size_scan_finish);
+		for (idx = 0; idx < ntasks; idx++)
+		{
+			if (!status && ret_array[idx])
+				status = (int)(INTPTR_T)ret_array[idx];
+		}
+		free(ret_array);
+		free(tasks);
+	} else if ((0 == status) && (1 == ntasks))
+		status = mu_size_scan_tree(queue[head].blk, queue[head].levl);
+	free(queue);
+	total_scans = (uint4)size_stats.blks[targ_levl];
+	total_recs = (uint4)size_stats.recs[targ_levl];
+	return status;
+}
+
+/* Runs in each process forked off by gtm_multi_proc */
+STATICFNDEF int mu_size_scan_worker(size_task_t *task)
+{
+	int	k, status;
+
+	multi_proc_key = task->key;
+	memset(&size_stats, 0, SIZEOF(size_stats));
+	for (k = 0; k <= MAX_BT_DEPTH; k++)
+	{
+		mu_int_adj[k] = 0;
+		mu_int_adj_prev[k] = 0;
+	}
+	status = mu_size_scan_tree(task->blk, task->levl);
+	if (0 == status)
+	{
+		for (k = 0; k <= MAX_BT_DEPTH; k++)
+			size_stats.adj[k] = mu_int_adj[k];
+		memcpy(&size_shm_stats[task->index], &size_stats, SIZEOF(size_stats));
+	}
+	return status;
+}
+
+STATICFNDEF int mu_size_scan_init(size_task_t *task)
+{	/* The statistics of each task follow the return values of the tasks (see gtm_multi_proc) */
+	size_shm_stats = (size_stats_t *)((sm_uc_ptr_t)multi_proc_shm_hdr->shm_ret_array
+					+ (SIZEOF(void *) * multi_proc_shm_hdr->ntasks));
+	memset(size_shm_stats, 0, SIZEOF(size_stats_t) * multi_proc_shm_hdr->ntasks);
+	return 0;
+}
+
+STATICFNDEF int mu_size_scan_finish(size_task_t *task)
+{
+	int		i, k, idx;
+	size_stats_t	*stats;
+
+	if (multi_proc_in_use)
+	{
+		multi_proc_key = NULL;	/* reset key now that parallel invocations are done */
+		DEBUG_ONLY(multi_proc_key_exception = TRUE;)	/* "multi_proc_in_use" stays TRUE until we return to
+								 * "gtm_multi_proc", so avoid asserts until then.
+								 */
+		/* Add up the statistics of the tasks while the shared memory is still around */
+		for (idx = 0; idx < multi_proc_shm_hdr->ntasks; idx++)
+		{
+			stats = &size_shm_stats[idx];
+			for (k = 0; k <= MAX_BT_DEPTH; k++)
+			{
+				size_stats.blks[k] += stats->blks[k];
+				size_stats.recs[k] += stats->recs[k];
+				size_stats.bytes[k] += stats->bytes[k];
+				for (i = 0; i < SIZE_FILL_BUCKETS; i++)
+					size_stats.fill[k][i] += stats->fill[k][i];
+				mu_int_adj[k] += stats->adj[k];
+			}
+		}
+		size_shm_stats = NULL;
+	}
+	return 0;
+}
+
+/* Prints the totals of every level from the root down to targ_levl and a histogram of how full their blocks are */
+STATICFNDEF void mu_size_scan_report(int root_levl)
+{
+	gtm_uint64_t	*fill, pct;
+	int		lvl;
+	uint4		blk_size;
+
+	blk_size = cs_data->blk_size;
+	util_out_print("!/Level          Blocks          Records            Bytes   Fill%", FLUSH);
+	for (lvl = root_levl; lvl >= targ_levl; lvl--)
+	{
+		pct = size_stats.blks[lvl] ? ((size_stats.bytes[lvl] * 100) / (size_stats.blks[lvl] * blk_size)) : 0;
+		util_out_print("!5UL !15@UQ !16@UQ !16@UQ !7UL", FLUSH, lvl, &size_stats.blks[lvl], &size_stats.recs[lvl],
+			&size_stats.bytes[lvl], (uint4)pct);
+	}
+	util_out_print("!/Blocks by fill factor", FLUSH);
+	util_out_print("Level     0-9%   10-19%   20-29%   30-39%   40-49%   50-59%   60-69%   70-79%   80-89%  90-100%", FLUSH);
+	for (lvl = root_levl; lvl >= targ_levl; lvl--)
+	{
+		fill = size_stats.fill[lvl];
+		util_out_print("!5UL !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ !8@UQ", FLUSH, lvl, &fill[0], &fill[1],
+			&fill[2], &fill[3], &fill[4], &fill[5], &fill[6], &fill[7], &fill[8], &fill[9]);
+	}
+}
+
+/* Counts a block of level lvl with bsiz bytes and rCnt records once its read has been validated */
+STATICFNDEF void size_count_blk(int lvl, uint4 bsiz, int4 rCnt)
+{
+	uint4	bucket;
+
+	bucket = (uint4)(((gtm_uint64_t)bsiz * SIZE_FILL_BUCKETS) / cs_data->blk_size);
+	size_stats.blks[lvl]++;
+	size_stats.recs[lvl] += rCnt;
+	size_stats.bytes[lvl] += bsiz;
+	size_stats.fill[lvl][MIN(bucket, SIZE_FILL_BUCKETS - 1)]++;
 }
 
 enum cdb_sc dfs(int lvl, sm_uc_ptr_t pBlkBase, boolean_t endtree, boolean_t skiprecs)
@@ -194,9 +508,11 @@ enum cdb_sc dfs(int lvl, sm_uc_ptr_t pBlkBase, boolean_t endtree, boolean_t skip
 	sm_uc_ptr_t			pTop, pRec, child_pBlkBase;
 	srch_hist			sibhist;
 	trans_num			ret_tn;
+	uint4				bsiz;
 	unsigned short			nRecLen;
 
 	assert(total_scans < MAX_SCANS);
+	bsiz = ((blk_hdr_ptr_t)pBlkBase)->bsiz;
 	if (lvl == targ_levl)
 	{	/* reached the bottom. count records in this block and validate */
 		BLK_LOOP(rCnt, pRec, pBlkBase, pTop, nRecLen)
@@ -237,7 +553,11 @@ enum cdb_sc dfs(int lvl, sm_uc_ptr_t pBlkBase, boolean_t endtree, boolean_t skip
 			next_skiprecs = skiprecs && first_iter;
 			status = dfs(lvl - 1, child_pBlkBase, next_endtree, next_skiprecs);
 			if (status != cdb_sc_normal)
+			{
+				if ((cdb_sc_endtree == status) && last_rec)
+					size_count_blk(lvl, bsiz, rCnt + 1);	/* validated along with its last child */
 				return status;
+			}
 			first_iter = FALSE;
 		}
 	}
@@ -245,8 +565,16 @@ enum cdb_sc dfs(int lvl, sm_uc_ptr_t pBlkBase, boolean_t endtree, boolean_t skip
 	memcpy(&sibhist.h[0], &gv_target->hist.h[lvl], SIZEOF(srch_blk_status) * (gv_target->hist.depth - lvl + 2));
 	if ((trans_num)0 == (ret_tn = t_end(&sibhist, NULL, TN_NOT_SPECIFIED)))
 		return cdb_sc_restarted;
+	if (incr_scans && (0 == lvl))
+	{	/* Data blocks have no children to check, so instead count how many of them follow the previous one closely in
+		 * key order. This is reported as the level 0 adjacency and shows how well MUPIP SET -CLUSTER_BLOCKS (or a
+		 * MUPIP REORG) keeps the global together.
+		 */
+		CHECK_ADJACENCY(gv_target->hist.h[0].blk_num, 1, mu_int_adj[1]);
+	}
 	total_recs += incr_recs;
 	total_scans += incr_scans;
+	size_count_blk(lvl, bsiz, rCnt);
 	if (endtree || mu_ctrlc_occurred || mu_ctrly_occurred)
 		return cdb_sc_endtree;	/* note: usage slightly different from elsewhere, since we've already done validation */
 	assert(lvl >= targ_levl);
@@ -82,9 +82,6 @@ error_def(ERR_MAXBTLEVEL);
 error_def(ERR_MUREORGFAIL);
 error_def(ERR_MUTRUNCNOTBG);
 
-#define RETRY_SWAP		(0)
-#define ABORT_SWAP		(1)
-
 void	mu_swap_root(glist *gl_ptr, int *root_swap_statistic_ptr)
 {
 	sgmnt_data_ptr_t	csd;
@@ -40,10 +40,12 @@
 #include "mupip_downgrade.h"
 #include "mupip_extend.h"
 #include "muextr.h"
+#include "mupip_flusher.h"
 #include "mupip_freeze.h"
 #include "util_help.h"
 #include "mupip_integ.h"
 #include "mupip_intrpt.h"
+#include "mupip_latency.h"
 #include "mupip_quit.h"
 #include "mupip_recover.h"
 #include "mupip_reorg.h"
@@ -297,6 +299,16 @@ static	CLI_ENTRY	mup_extract_qual[] = {
 	{ "" }
 };
 
+static	CLI_PARM	mup_flusher_parm[] = {
+	{ "REG_NAME", "Region: ", PARM_REQ},
+	{ "", "",                 PARM_REQ}
+};
+
+static	CLI_ENTRY	mup_flusher_qual[] = {
+	{ "CLEAN_PERCENT", mupip_flusher, 0, 0, 0, 0, 0, VAL_REQ, 0, NON_NEG, VAL_NUM, 0 },
+	{ "" }
+};
+
 static	CLI_PARM	mup_freeze_parm[] = {
 	{ "REG_NAME", "Region: ", PARM_REQ},
 	{ "", "",                 PARM_REQ}
@@ -441,6 +453,16 @@ static	CLI_ENTRY	mup_journal_qual[] = {
 { "" }
 };
 
+static	CLI_PARM	mup_latency_parm[] = {
+	{ "REG_NAME", "Region: ", PARM_REQ},
+	{ "", "",                 PARM_REQ}
+};
+
+static	CLI_ENTRY	mup_latency_qual[] = {
+	{ "HISTOGRAM", mupip_latency, 0, 0, 0, 0, 0, VAL_DISALLOWED, 0, NON_NEG, VAL_N_A, 0 },
+	{ "" }
+};
+
 static	CLI_PARM	mup_load_parm[] = {
 	{ "FILE", "Input File: ", PARM_NOT_REQ},
 	{ "", "", PARM_REQ}
@@ -479,11 +501,15 @@ static readonly CLI_PARM mup_reorg_ff_parm[] = {
 
 /* USER_DEFINED_REORG is currently undocumented */
 static  CLI_ENTRY       mup_reorg_qual[] = {
+	{ "COMPACT",            mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A, 0       },
 	{ "DOWNGRADE",          mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A, 0       },
 	{ "ENCRYPT",            mupip_reorg, 0, 0,                 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_STR, 0       },
 	{ "EXCLUDE",            mupip_reorg, 0, 0,                 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_STR, 0       },
 	{ "FILL_FACTOR",        mupip_reorg, 0, mup_reorg_ff_parm, 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM, 0       },
+	{ "FREE_DEFERRED",      mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A, 0       },
 	{ "INDEX_FILL_FACTOR",  mupip_reorg, 0, mup_reorg_ff_parm, 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM, 0       },
+	{ "PARALLEL",           mupip_reorg, 0, 0,                 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM, VAL_DCM },
+	{ "RATE",               mupip_reorg, 0, 0,                 0, 0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM, VAL_DCM },
 	{ "REGION",             mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A, 0       },
 	{ "RESUME",             mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A, 0       },
 	{ "SAFEJNL",            mupip_reorg, 0, 0,                 0, 0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A, 0       },
@@ -503,6 +529,7 @@ static CLI_ENTRY mup_size_heuristic_qual[] = {
 	{ "ARSAMPLE",	0, 0, 0, 0, 0, 0, VAL_DISALLOWED,	0, NON_NEG, VAL_N_A, 0 	},
 	{ "IMPSAMPLE",	0, 0, 0, 0, 0, 0, VAL_DISALLOWED,	0, NON_NEG, VAL_N_A, 0 	},
 	{ "LEVEL",	0, 0, 0, 0, 0, 0, VAL_REQ,		1, NON_NEG, VAL_STR, 0	},	/* VAL_STR to be able to get negative values */
+	{ "PARALLEL",	0, 0, 0, 0, 0, 0, VAL_REQ,		1, NON_NEG, VAL_NUM, VAL_DCM},
 	{ "SAMPLES",	0, 0, 0, 0, 0, 0, VAL_REQ,		1, NON_NEG, VAL_NUM, VAL_DCM},
 	{ "SCAN",	0, 0, 0, 0, 0, 0, VAL_DISALLOWED,	0, NON_NEG, VAL_N_A, 0 	},
 	{ "SEED",	0, 0, 0, 0, 0, 0, VAL_REQ,		1, NON_NEG, VAL_NUM, VAL_DCM},
@@ -703,17 +730,20 @@ static	CLI_ENTRY	mup_set_qual[] = {
 { "ACCESS_METHOD",        mupip_set, 0, 0,			mup_set_acc_qual,		0, 0, VAL_REQ,        1, NON_NEG, VAL_STR,  0 },
 { "ASYNCIO",              mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "BYPASS",               mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
+{ "CLUSTER_BLOCKS",       mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  VAL_DCM },
 { "DBFILENAME",           mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NEG,     VAL_STR,  0 },
 { "DEFER_ALLOCATE",       mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "DEFER_TIME",           mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NEG,     VAL_STR,  0 },
 { "ENCRYPTABLE",          mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "ENCRYPTIONCOMPLETE",   mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
 { "EPOCHTAPER",           mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
+{ "EXTEND_AHEAD",         mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  VAL_DCM },
 { "EXTENSION_COUNT",      mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
 { "FILE",                 mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
 { "FLUSH_TIME",           mupip_set, 0, mup_set_ftime_parm,	0,				0, 0, VAL_NOT_REQ,    1, NON_NEG, VAL_TIME, 0 },
 { "GLOBAL_BUFFERS",       mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
 { "HARD_SPIN_COUNT",      mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  VAL_DCM },
+{ "HUGE_PAGES",           mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  VAL_DCM },
 { "INST_FREEZE_ON_ERROR", mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "JNLFILE",              mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
 { "JOURNAL",              mupip_set, 0, 0,			mup_set_journal_qual,		0, 0, VAL_NOT_REQ,    1, NEG,     VAL_STR,  0 },
@@ -722,6 +752,7 @@ static	CLI_ENTRY	mup_set_qual[] = {
 { "LOCK_SPACE",           mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
 { "MUTEX_SLOTS",          mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
 { "NULL_SUBSCRIPTS",      mupip_set, 0, 0,			mup_null_subs_qual,		0, 0, VAL_REQ,        1, NON_NEG, VAL_STR,  0 },
+{ "NUMA_INTERLEAVE",      mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "PARTIAL_RECOV_BYPASS", mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
 { "PREVJNLFILE",          mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NEG,     VAL_STR,  0 },
 { "QDBRUNDOWN",           mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
@@ -732,6 +763,7 @@ static	CLI_ENTRY	mup_set_qual[] = {
 { "REPLICATION",          mupip_set, 0, 0,			mup_repl_qual,			0, 0, VAL_REQ,        1, NEG,     VAL_STR,  0 },
 { "REPL_STATE",           mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NEG,     VAL_STR,  0 },
 { "RESERVED_BYTES",       mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
+{ "SCAN_RESISTANT",       mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NEG,     VAL_N_A,  0 },
 { "SLEEP_SPIN_COUNT",     mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  0 },
 { "SPIN_SLEEP_MASK",      mupip_set, 0, 0,			0,				0, 0, VAL_REQ,        1, NON_NEG, VAL_NUM,  VAL_HEX },
 { "STANDALONENOT",        mupip_set, 0, 0,			0,				0, 0, VAL_DISALLOWED, 1, NON_NEG, VAL_N_A,  0 },
@@ -809,6 +841,7 @@ GBLDEF	CLI_ENTRY	mupip_cmd_ary[] = {
 { "EXIT",	mupip_quit,		0,			0,			0, 0,				0, VAL_DISALLOWED, 0, 0, 0, 0 },
 { "EXTEND",	mupip_extend,		mup_extend_qual,	mup_extend_parm,	0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "EXTRACT",	mu_extract,		mup_extract_qual,	mup_extract_parm,	0, cli_disallow_mupip_extract,	0, VAL_DISALLOWED, 1, 0, 0, 0 },
+{ "FLUSHER",	mupip_flusher,		mup_flusher_qual,	mup_flusher_parm,	0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "FREEZE",	mupip_freeze,		mup_freeze_qual,	mup_freeze_parm,	0, cli_disallow_mupip_freeze,	0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "FTOK",	mupip_ftok,		mup_ftok_qual,		mup_ftok_parm,		0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "HASH",	mupip_hash,		0,			0,			0, 0,				0, VAL_DISALLOWED, MAX_PARMS, 0, 0, 0 },
@@ -816,6 +849,7 @@ GBLDEF	CLI_ENTRY	mupip_cmd_ary[] = {
 { "INTEG",	mupip_integ,		mup_integ_qual,		mup_integ_parm,		0, cli_disallow_mupip_integ,	0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "INTRPT",	mupip_intrpt,		0,			mup_intrpt_parm,	0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "JOURNAL",	mupip_recover,		mup_journal_qual,	mup_journal_parm,	0, cli_disallow_mupip_journal,	0, VAL_DISALLOWED, 1, 0, 0, 0 },
+{ "LATENCY",	mupip_latency,		mup_latency_qual,	mup_latency_parm,	0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "LOAD",	mupip_cvtgbl,		mup_load_qual,		mup_load_parm,		0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
 { "QUIT",	mupip_quit,		0,			0,			0, 0,				0, VAL_DISALLOWED, 0, 0, 0, 0 },
 { "RCTLDUMP",	mupip_rctldump, 	0,                      mup_rctldump_parm,	0, 0,				0, VAL_DISALLOWED, 1, 0, 0, 0 },
@@ -243,6 +243,35 @@ boolean_t cli_disallow_mupip_reorg(void)
 	CLI_DIS_CHECK_N_RESET;
 	disallow_return_value = d_c_cli_present("ENCRYPT") && !d_c_cli_present("REGION");
 	CLI_DIS_CHECK_N_RESET;
+	disallow_return_value = (d_c_cli_present("DOWNGRADE")
+				|| d_c_cli_present("ENCRYPT")
+				|| d_c_cli_present("EXCLUDE")
+				|| d_c_cli_present("FILL_FACTOR")
+				|| d_c_cli_present("INDEX_FILL_FACTOR")
+				|| d_c_cli_present("RESUME")
+				|| d_c_cli_present("SELECT")
+				|| d_c_cli_present("TRUNCATE")
+				|| d_c_cli_present("UPGRADE")
+				|| d_c_cli_present("USER_DEFINED_REORG")) && d_c_cli_present("FREE_DEFERRED");
+	CLI_DIS_CHECK_N_RESET;
+	disallow_return_value = d_c_cli_present("FREE_DEFERRED") && !d_c_cli_present("REGION");
+	CLI_DIS_CHECK_N_RESET;
+	disallow_return_value = (d_c_cli_present("DOWNGRADE")
+				|| d_c_cli_present("ENCRYPT")
+				|| d_c_cli_present("EXCLUDE")
+				|| d_c_cli_present("FILL_FACTOR")
+				|| d_c_cli_present("FREE_DEFERRED")
+				|| d_c_cli_present("INDEX_FILL_FACTOR")
+				|| d_c_cli_present("PARALLEL")
+				|| d_c_cli_present("RATE")
+				|| d_c_cli_present("RESUME")
+				|| d_c_cli_present("SELECT")
+				|| d_c_cli_present("TRUNCATE")
+				|| d_c_cli_present("UPGRADE")
+				|| d_c_cli_present("USER_DEFINED_REORG")) && d_c_cli_present("COMPACT");
+	CLI_DIS_CHECK_N_RESET;
+	disallow_return_value = d_c_cli_present("COMPACT") && !d_c_cli_present("REGION");
+	CLI_DIS_CHECK_N_RESET;
 	return FALSE;
 }
 
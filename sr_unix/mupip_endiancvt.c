@@ -92,6 +92,7 @@ error_def(ERR_TEXT);
 #define NOTFULLYUPGRADED	"some blocks are not upgraded to the current version"
 #define KILLINPROG		"kills in progress"
 #define ABANDONED_KILLS		"abandoned kills present"
+#define DEFER_FREE		"deferred KILL subtrees not yet freed"
 #define GTCMSERVERACTIVE	"a GT.CM server accessing the database"
 #define	RECOVINTRPT		"recovery was interrupted"
 #define DBCREATE		"database creation in progress"
@@ -268,6 +269,12 @@ void mupip_endiancvt(void)
 				check_error = ABANDONED_KILLS;
 				GTM_PUTMSG_CSA(VARLSTCNT(6) ERR_NOENDIANCVT, 4, n_len, db_name, LEN_AND_STR(check_error));
 			}
+			swap_uint4 = GTM_BYTESWAP_32(old_data->defer_free_cnt);
+			if (0 != swap_uint4)
+			{
+				check_error = DEFER_FREE;
+				GTM_PUTMSG_CSA(VARLSTCNT(6) ERR_NOENDIANCVT, 4, n_len, db_name, LEN_AND_STR(check_error));
+			}
 			swap_uint4 = GTM_BYTESWAP_32(old_data->rc_srv_cnt);
 			if (0 != swap_uint4)
 			{
@@ -384,6 +391,11 @@ void mupip_endiancvt(void)
 				check_error = ABANDONED_KILLS;
 				GTM_PUTMSG_CSA(VARLSTCNT(6) ERR_NOENDIANCVT, 4, n_len, db_name, LEN_AND_STR(check_error));
 			}
+			if (0 != old_data->defer_free_cnt)
+			{
+				check_error = DEFER_FREE;
+				GTM_PUTMSG_CSA(VARLSTCNT(6) ERR_NOENDIANCVT, 4, n_len, db_name, LEN_AND_STR(check_error));
+			}
 			if (0 != old_data->rc_srv_cnt)
 			{
 				check_error = GTCMSERVERACTIVE;
@@ -0,0 +1,231 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+#include "gtm_time.h"
+
+#include "ast.h"		/* needed for JNL_ENSURE_OPEN_WCS_WTSTART macro in gdsfhead.h */
+#include "gdsroot.h"
+#include "gdsblk.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "gdscc.h"
+#include "gdskill.h"
+#include "jnl.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "tp.h"
+#include "repl_msg.h"		/* for gtmsource.h */
+#include "gtmsource.h"		/* for jnlpool_addrs_ptr_t */
+#include "cli.h"
+#include "util.h"
+#include "min_max.h"
+#include "gvcst_protos.h"	/* for gvcst_init prototype */
+#include "gdsfilext.h"
+#include "interlock.h"
+#include "is_proc_alive.h"
+#include "mupip_exit.h"
+#include "mu_getlst.h"
+#include "mu_outofband_setup.h"
+#include "mupip_flusher.h"
+#include "wcs_backoff.h"
+#include "wcs_wt.h"
+
+GBLREF	boolean_t		jnlpool_init_needed;
+GBLREF	bool			error_mupip;
+GBLREF	bool			mu_ctrlc_occurred;
+GBLREF	bool			mu_ctrly_occurred;
+GBLREF	gd_region		*gv_cur_region;
+GBLREF	sgmnt_addrs		*cs_addrs;
+GBLREF	sgmnt_data_ptr_t	cs_data;
+GBLREF	tp_region		*grlist;
+GBLREF	uint4			process_id;
+
+error_def(ERR_MUNOACTION);
+error_def(ERR_MUNOFINISH);
+
+#define	FLUSHER_CLEAN_PCT_DEF	50	/* default -CLEAN_PERCENT */
+#define	FLUSHER_EPOCH_LEAD	2	/* seconds before a before image epoch that the flusher starts emptying the cache */
+#define	FLUSHER_SLEEP_MIN	1	/* milliseconds to sleep after a pass which had to write */
+#define	FLUSHER_SLEEP_MAX	64	/* milliseconds to sleep at most once there is nothing to write */
+
+typedef struct
+{
+	gd_region	*reg;
+	trans_num	last_tn;	/* curr_tn seen in the previous pass */
+	uint4		idle_msec;	/* time during which curr_tn has not moved */
+	uint4		extend_failed;	/* total_blks when gdsfilext_ahead last failed; not retried until the file changes size */
+} flusher_reg_t;
+
+/* MUPIP FLUSHER <region-list> [-CLEAN_PERCENT=n]
+ *
+ * Runs (until MUPIP STOP or <CTRL-C>) as the process that writes dirty global buffers of the listed BG regions to the database
+ * file, so that processes doing updates rarely have to. Each pass looks at the number of dirty buffers of every region and, if
+ * more than 100-n percent of the buffers are dirty, writes the excess with wcs_wtstart. The limit drops to zero (every dirty
+ * buffer is written) in the FLUSHER_EPOCH_LEAD seconds before the next epoch of a before image journaled region, so that the
+ * epoch itself finds few buffers to flush, and once the region has seen no update for its flush timer interval, in place of
+ * the stale buffer timer. The flusher sleeps FLUSHER_SLEEP_MIN milliseconds after a pass that had to write and twice as long
+ * as the previous sleep (up to FLUSHER_SLEEP_MAX) otherwise, so the write rate follows the update rate.
+ *
+ * For a region with MUPIP SET -EXTEND_AHEAD=p, each pass also checks whether fewer than p percent of the blocks are free and
+ * if so extends the file by its extension size (see gdsfilext_ahead), so that updates find free blocks instead of having to
+ * extend the file themselves.
+ *
+ * While it runs, cnl->flusher_pid names it and foreground processes skip their epoch taper writes and stale buffer flushes
+ * (see FLUSHER_ACTIVE). They still write themselves on reaching the flush trigger or running out of clean buffers, so a
+ * flusher that cannot keep up only costs what not having one would.
+ */
+void mupip_flusher(void)
+{
+	boolean_t		wrote;
+	flusher_reg_t		*freg, *freg_top, *fregs;
+	gd_region		*reg;
+	int			nregs;
+	int4			clean_pct, dirty, max_dirty, wtstart_errno;
+	jnl_buffer_ptr_t	jb;
+	jnl_tm_t		now;
+	node_local_ptr_t	cnl;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	tp_region		*rptr;
+	uint4			flusher_pid, next_epoch_time, sleep_msec, status, total_blks;
+
+	mu_outofband_setup();
+	error_mupip = FALSE;
+	jnlpool_init_needed = TRUE;	/* in case gdsfilext_ahead journals an extension of a replicated region */
+	if (CLI_PRESENT == cli_present("CLEAN_PERCENT"))
+	{
+		if (!cli_get_int("CLEAN_PERCENT", &clean_pct) || (0 > clean_pct) || (100 < clean_pct))
+		{
+			util_out_print("CLEAN_PERCENT must be between 0 and 100", TRUE);
+			mupip_exit(ERR_MUNOACTION);
+		}
+	} else
+		clean_pct = FLUSHER_CLEAN_PCT_DEF;
+	gvinit();
+	mu_getlst("REG_NAME", SIZEOF(tp_region));
+	if (error_mupip || (NULL == grlist))
+		mupip_exit(ERR_MUNOACTION);
+	status = SS_NORMAL;
+	for (nregs = 0, rptr = grlist; NULL != rptr; rptr = rptr->fPtr)
+		nregs++;
+	fregs = (flusher_reg_t *)malloc(SIZEOF(flusher_reg_t) * nregs);
+	freg_top = fregs;
+	for (rptr = grlist; NULL != rptr; rptr = rptr->fPtr)
+	{
+		reg = rptr->reg;
+		if ((dba_bg != REG_ACC_METH(reg)) || reg_cmcheck(reg))
+		{
+			util_out_print("Region !AD is not a local BG database", TRUE, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		gvcst_init(reg);
+		if (reg->was_open)	/* Already open under another name.  Region will not be marked open */
+		{
+			reg->open = FALSE;
+			util_out_print("Region !AD is already open under another name", TRUE, REG_LEN_STR(reg));
+			continue;
+		}
+		if (reg->read_only)
+		{
+			util_out_print("Region !AD : MUPIP FLUSHER cannot run on a read-only database", TRUE, REG_LEN_STR(reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		cnl = FILE_INFO(reg)->s_addrs.nl;
+		flusher_pid = cnl->flusher_pid;
+		if (flusher_pid && (process_id != flusher_pid) && is_proc_alive(flusher_pid, 0))
+		{
+			util_out_print("Region !AD already has MUPIP FLUSHER process !UL", TRUE, REG_LEN_STR(reg), flusher_pid);
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		cnl->flusher_pid = process_id;
+		freg_top->reg = reg;
+		freg_top->last_tn = FILE_INFO(reg)->s_addrs.ti->curr_tn;
+		freg_top->idle_msec = 0;
+		freg_top->extend_failed = 0;
+		freg_top++;
+		util_out_print("Region !AD : MUPIP FLUSHER started keeping !UL percent of the global buffers clean", TRUE,
+			REG_LEN_STR(reg), clean_pct);
+	}
+	sleep_msec = FLUSHER_SLEEP_MIN;
+	while ((fregs < freg_top) && !mu_ctrly_occurred && !mu_ctrlc_occurred)
+	{
+		wrote = FALSE;
+		for (freg = fregs; freg < freg_top; freg++)
+		{
+			reg = freg->reg;
+			TP_CHANGE_REG(reg);	/* sets gv_cur_region, cs_addrs, cs_data */
+			csa = cs_addrs;
+			csd = csa->hdr;
+			cnl = csa->nl;
+			if (0 == cnl->flusher_pid)
+				cnl->flusher_pid = process_id;	/* cleared by a process that thought we were gone */
+			if (csa->ti->curr_tn != freg->last_tn)
+			{
+				freg->last_tn = csa->ti->curr_tn;
+				freg->idle_msec = 0;
+			} else
+				freg->idle_msec += sleep_msec;
+			if (csd->extend_ahead_pct && (csa->ti->total_blks != freg->extend_failed) && !FROZEN_CHILLED(csa)
+				&& (((gtm_uint64_t)csa->ti->free_blocks * 100)
+					< ((gtm_uint64_t)csa->ti->total_blks * csd->extend_ahead_pct)))
+			{
+				total_blks = csa->ti->total_blks;
+				if (SS_NORMAL != gdsfilext_ahead())
+				{
+					freg->extend_failed = total_blks;
+					util_out_print("Region !AD : MUPIP FLUSHER could not extend the database file", TRUE,
+						REG_LEN_STR(reg));
+				}
+				wrote = TRUE;
+			}
+			dirty = cnl->wcs_active_lvl;
+			if ((0 >= dirty) || FROZEN_CHILLED(csa))
+				continue;
+			max_dirty = (csd->n_bts * (100 - clean_pct)) / 100;
+			if (freg->idle_msec >= (uint4)csd->flush_time[0])
+				max_dirty = 0;	/* no updates for a while: write everything as the stale buffer timer would */
+			else if (JNL_ENABLED(csd) && csd->jnl_before_image && (NULL != csa->jnl)
+					&& (NULL != (jb = csa->jnl->jnl_buff)))
+			{
+				JNL_SHORT_TIME(now);
+				next_epoch_time = jb->next_epoch_time;
+				if ((next_epoch_time > now) && ((next_epoch_time - now) <= FLUSHER_EPOCH_LEAD))
+					max_dirty = 0;	/* empty the cache so the epoch has little left to write */
+			}
+			if (dirty <= max_dirty)
+				continue;
+			JNL_ENSURE_OPEN_WCS_WTSTART(csa, reg, dirty - max_dirty, NULL, FALSE, wtstart_errno);
+			wrote = TRUE;
+		}
+		sleep_msec = wrote ? FLUSHER_SLEEP_MIN : MIN(2 * sleep_msec, FLUSHER_SLEEP_MAX);
+		SHORT_SLEEP(sleep_msec);
+	}
+	for (freg = fregs; freg < freg_top; freg++)
+	{
+		cnl = FILE_INFO(freg->reg)->s_addrs.nl;
+		if (process_id == cnl->flusher_pid)
+			cnl->flusher_pid = 0;
+		util_out_print("Region !AD : MUPIP FLUSHER stopped", TRUE, REG_LEN_STR(freg->reg));
+	}
+	free(fregs);
+	mupip_exit(status);
+}
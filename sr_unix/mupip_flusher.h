@@ -0,0 +1,18 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef MUPIP_FLUSHER_INCLUDED
+#define MUPIP_FLUSHER_INCLUDED
+
+void mupip_flusher(void);
+
+#endif /* MUPIP_FLUSHER_INCLUDED */
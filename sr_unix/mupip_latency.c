@@ -0,0 +1,122 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "gdscc.h"
+#include "gdskill.h"
+#include "jnl.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "tp.h"
+#include "cli.h"
+#include "util.h"
+#include "gvstats_rec.h"
+#include "gvcst_protos.h"	/* for gvcst_init prototype */
+#include "mupip_exit.h"
+#include "mu_getlst.h"
+#include "mu_outofband_setup.h"
+#include "mupip_latency.h"
+
+GBLREF	bool		error_mupip;
+GBLREF	bool		mu_ctrlc_occurred;
+GBLREF	bool		mu_ctrly_occurred;
+GBLREF	gd_region	*gv_cur_region;
+GBLREF	tp_region	*grlist;
+
+error_def(ERR_MUNOACTION);
+error_def(ERR_MUNOFINISH);
+
+/* MUPIP LATENCY <region-list> [-HISTOGRAM]
+ *
+ * Reports the operation latency histograms that processes running with $ydb_gvstats_latency set accumulate in the shared
+ * memory of each database (see tab_gvstats_lat.h). For every operation with at least one sample, prints the count, the
+ * mean and the 50th/90th/99th/99.9th percentiles in microseconds. The percentiles are bucket upper bounds and so only have
+ * power of 2 resolution. -HISTOGRAM additionally prints the non-empty buckets, each labelled with its lower bound.
+ */
+void mupip_latency(void)
+{
+	boolean_t		histogram;
+	gvstats_lat_t		lat[n_gvstats_lat_types];
+	gtm_uint64_t		count, avg, p50, p90, p99, p999;
+	int			type, bucket;
+	sgmnt_addrs		*csa;
+	tp_region		*rptr;
+	uint4			status;
+	static readonly char	*opnames[] = {
+#					define TAB_GVSTATS_LAT(TYPE,TEXT1,TEXT2)	TEXT1,
+#					include "tab_gvstats_lat.h"
+#					undef TAB_GVSTATS_LAT
+				     };
+
+	mu_outofband_setup();
+	error_mupip = FALSE;
+	histogram = (CLI_PRESENT == cli_present("HISTOGRAM"));
+	gvinit();
+	mu_getlst("REG_NAME", SIZEOF(tp_region));
+	if (error_mupip || (NULL == grlist))
+		mupip_exit(ERR_MUNOACTION);
+	status = SS_NORMAL;
+	for (rptr = grlist; NULL != rptr; rptr = rptr->fPtr)
+	{
+		if (mu_ctrly_occurred || mu_ctrlc_occurred)
+			break;
+		if (!IS_REG_BG_OR_MM(rptr->reg) || reg_cmcheck(rptr->reg))
+		{
+			util_out_print("Region !AD is not a local BG or MM database", TRUE, REG_LEN_STR(rptr->reg));
+			status = ERR_MUNOFINISH;
+			continue;
+		}
+		gv_cur_region = rptr->reg;
+		gvcst_init(gv_cur_region);
+		if (gv_cur_region->was_open)	/* Already open under another name.  Region will not be marked open*/
+		{
+			gv_cur_region->open = FALSE;
+			util_out_print("Region !AD is already open under another name", TRUE, REG_LEN_STR(rptr->reg));
+			continue;
+		}
+		csa = &FILE_INFO(gv_cur_region)->s_addrs;
+		gvstats_lat_cnl_sum(csa->nl, lat);
+		util_out_print("!/Region !AD", TRUE, REG_LEN_STR(rptr->reg));
+		util_out_print("  Operation             Count      Avg(us)      P50(us)      P90(us)      P99(us)    P99.9(us)", TRUE);
+		for (type = 0; type < n_gvstats_lat_types; type++)
+		{
+			count = gvstats_lat_count(&lat[type]);
+			if (0 == count)
+				continue;
+			avg = lat[type].sum_usec / count;
+			p50 = gvstats_lat_percentile(&lat[type], count, 500);
+			p90 = gvstats_lat_percentile(&lat[type], count, 900);
+			p99 = gvstats_lat_percentile(&lat[type], count, 990);
+			p999 = gvstats_lat_percentile(&lat[type], count, 999);
+			util_out_print("  !AZ      !16@UQ !12@UQ !12@UQ !12@UQ !12@UQ !12@UQ", TRUE, opnames[type], &count, &avg,
+				&p50, &p90, &p99, &p999);
+			if (!histogram)
+				continue;
+			for (bucket = 0; bucket < GVSTATS_LAT_BUCKETS; bucket++)
+			{
+				if (lat[type].bucket[bucket])
+					util_out_print("      >= !10UL us !16@UQ", TRUE, (bucket ? (1 << (bucket - 1)) : 0),
+						&lat[type].bucket[bucket]);
+			}
+		}
+	}
+	mupip_exit(status);
+}
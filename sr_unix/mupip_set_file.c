@@ -122,11 +122,12 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 	enum db_acc_method	access, access_new;
 	enum db_ver		desired_dbver;
 	gd_region		*temp_cur_region;
-	int			asyncio_status, defer_allocate_status, defer_status, disk_wait_status, encryptable_status,
-				encryption_complete_status, epoch_taper_status, extn_count_status, fd, fn_len, glbl_buff_status,
-				gtmcrypt_errno, hard_spin_status, inst_freeze_on_error_status, key_size_status, locksharesdbcrit,
-				lock_space_status, mutex_space_status, null_subs_status, qdbrundown_status, read_only_status,
-				rec_size_status, reg_exit_stat, reorg_sleep_nsec_status, rc, rsrvd_bytes_status, save_errno,
+	int			asyncio_status, cluster_blocks_status, defer_allocate_status, defer_status, disk_wait_status,
+				encryptable_status, encryption_complete_status, epoch_taper_status, extend_ahead_status,
+				extn_count_status, fd, fn_len, glbl_buff_status, gtmcrypt_errno, hard_spin_status, huge_pages_status,
+				inst_freeze_on_error_status, key_size_status, locksharesdbcrit, lock_space_status, mutex_space_status,
+				null_subs_status, numa_interleave_status, qdbrundown_status, read_only_status, rec_size_status,
+				reg_exit_stat, reorg_sleep_nsec_status, rc, rsrvd_bytes_status, save_errno, scan_resistant_status,
 				sleep_cnt_status, spin_sleep_status, stats_status, status, status1, stdnullcoll_status,
 				trigger_flush_limit_status, wrt_per_flu_status;
 	int4			defer_time, new_cache_size, new_disk_wait, new_extn_count, new_flush_trigger, new_hard_spin,
@@ -137,7 +138,7 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 	unsigned short		acc_spec_len = MAX_ACC_METH_LEN, ver_spec_len = MAX_DB_VER_LEN;
 	gd_segment		*seg;
 	uint4			fsb_size, reservedDBFlags;
-	uint4			reorg_sleep_nsec;
+	uint4			cluster_blocks, extend_ahead_pct, huge_page_mb, reorg_sleep_nsec;
 	ZOS_ONLY(int 		realfiletag;)
 	DCL_THREADGBL_ACCESS;
 
@@ -173,6 +174,8 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 	if (asyncio_status = cli_present("ASYNCIO"))
 		need_standalone = TRUE;
 	defer_allocate_status = cli_present("DEFER_ALLOCATE");
+	scan_resistant_status = cli_present("SCAN_RESISTANT");
+	numa_interleave_status = cli_present("NUMA_INTERLEAVE");
 	if (encryptable_status = cli_present("ENCRYPTABLE"))
 	{
 		need_standalone = TRUE;
@@ -290,6 +293,48 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 			exit_stat |= EXIT_ERR;
 		}
 	}
+	if (cluster_blocks_status = cli_present("CLUSTER_BLOCKS"))
+	{
+		if (cli_get_int("CLUSTER_BLOCKS", (int4 *)&cluster_blocks))
+		{
+			if (BLKS_PER_LMAP < cluster_blocks)
+			{	/* a cluster larger than a local bitmap would not be kept together by bm_getfree anyways */
+				gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUPIPSET2BIG, 4, cluster_blocks,
+					LEN_AND_LIT("CLUSTER_BLOCKS"), BLKS_PER_LMAP);
+				exit_stat |= EXIT_ERR;
+			}
+		} else
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SETQUALPROB, 2, LEN_AND_LIT("CLUSTER_BLOCKS"));
+			exit_stat |= EXIT_ERR;
+		}
+	}
+	if (extend_ahead_status = cli_present("EXTEND_AHEAD"))
+	{	/* percentage of free blocks below which MUPIP FLUSHER extends the file */
+		if (!cli_get_int("EXTEND_AHEAD", (int4 *)&extend_ahead_pct))
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SETQUALPROB, 2, LEN_AND_LIT("EXTEND_AHEAD"));
+			exit_stat |= EXIT_ERR;
+		} else if (MAX_EXTEND_AHEAD_PCT < extend_ahead_pct)
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUPIPSET2BIG, 4, extend_ahead_pct,
+				LEN_AND_LIT("EXTEND_AHEAD"), MAX_EXTEND_AHEAD_PCT);
+			exit_stat |= EXIT_ERR;
+		}
+	}
+	if (huge_pages_status = cli_present("HUGE_PAGES"))
+	{	/* 0 (normal pages) or a huge page size in MiB; the kernel only knows power of 2 sizes */
+		if (!cli_get_int("HUGE_PAGES", (int4 *)&huge_page_mb) || (huge_page_mb & (huge_page_mb - 1)))
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_SETQUALPROB, 2, LEN_AND_LIT("HUGE_PAGES"));
+			exit_stat |= EXIT_ERR;
+		} else if (MAX_SHM_HUGE_PAGE_MB < huge_page_mb)
+		{
+			gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(6) ERR_MUPIPSET2BIG, 4, huge_page_mb,
+				LEN_AND_LIT("HUGE_PAGES"), MAX_SHM_HUGE_PAGE_MB);
+			exit_stat |= EXIT_ERR;
+		}
+	}
 	if (locksharesdbcrit = cli_present("LCK_SHARES_DB_CRIT"))
 		need_standalone = TRUE;
 	if (lock_space_status = cli_present("LOCK_SPACE"))
@@ -928,6 +973,16 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
 				csd->n_wrt_per_flu = new_wrt_per_flu;
 			if (reorg_sleep_nsec_status)
 				csd->reorg_sleep_nsec = reorg_sleep_nsec;
+			if (cluster_blocks_status)
+				csd->alloc_cluster = cluster_blocks;
+			if (scan_resistant_status)
+				csd->scan_resistant = (CLI_PRESENT == scan_resistant_status);
+			if (huge_pages_status)
+				csd->shm_huge_page_mb = huge_page_mb;
+			if (extend_ahead_status)
+				csd->extend_ahead_pct = extend_ahead_pct;
+			if (numa_interleave_status)
+				csd->shm_numa_interleave = (CLI_PRESENT == numa_interleave_status);
 			/* --------------------- report results ------------------------- */
 			if (asyncio_status)
 			{
@@ -979,6 +1034,21 @@ int4 mupip_set_file(int db_fn_len, char *db_fn)
                         if (reorg_sleep_nsec_status)
 				util_out_print("Database file !AD now has reorg sleep nanoseconds !UL",
                                         TRUE, fn_len, fn, csd->reorg_sleep_nsec);
+			if (cluster_blocks_status)
+				util_out_print("Database file !AD now has cluster blocks !UL",
+					TRUE, fn_len, fn, csd->alloc_cluster);
+			if (scan_resistant_status)
+				util_out_print("Database file !AD now has scan resistant buffer replacement set to !AD", TRUE,
+					fn_len, fn, 5, (csd->scan_resistant ? " TRUE" : "FALSE"));
+			if (huge_pages_status)
+				util_out_print("Database file !AD now has huge page size (MiB) !UL", TRUE,
+					fn_len, fn, csd->shm_huge_page_mb);
+			if (extend_ahead_status)
+				util_out_print("Database file !AD now has extend ahead percentage !UL", TRUE,
+					fn_len, fn, csd->extend_ahead_pct);
+			if (numa_interleave_status)
+				util_out_print("Database file !AD now has NUMA interleave set to !AD", TRUE,
+					fn_len, fn, 5, (csd->shm_numa_interleave ? " TRUE" : "FALSE"));
 			if (got_standalone)
 			{
 				DB_LSEEKWRITE(NULL, ((unix_db_info *)NULL), NULL, fd, 0, pvt_csd, SIZEOF(sgmnt_data), status);
@@ -70,6 +70,7 @@ typedef struct {
 	int4 					samples;
 	int4 					level;
 	int4					seed;
+	int4					parallel;
 } mupip_size_cfg_t;
 
 STATICFNDCL void mupip_size_check_error(void);
@@ -87,7 +88,7 @@ void mupip_size(void)
 	char 			*p_end;						/* used for strtol validation */
 	glist			exclude_gl_head, gl_head, *gl_ptr;
 	int4			reg_max_rec, reg_max_key, reg_max_blk;
-	mupip_size_cfg_t	mupip_size_cfg = { impsample, 1000, 1, 0 };	/* configuration default values */
+	mupip_size_cfg_t	mupip_size_cfg = { impsample, 1000, 1, 0, 0 };	/* configuration default values */
 	uint4			status = EXIT_NRM;
 	unsigned short		BUFF_LEN = SIZEOF(buff), n_len;
 	sgmnt_addrs 		*tcsa;
@@ -158,6 +159,16 @@ void mupip_size(void)
 			}
 		}
 		/* else level is already initialized with default value */
+		if (cli_present("HEURISTIC.PARALLEL"))
+		{
+			boolean_t valid = cli_get_int("HEURISTIC.PARALLEL", &(mupip_size_cfg.parallel));
+			if (!valid || mupip_size_cfg.parallel <= 0 || MAX_SIZE_WORKERS < mupip_size_cfg.parallel)
+			{
+				error_mupip = TRUE;
+				gtm_putmsg_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_MUSIZEINVARG, 2, LEN_AND_LIT("HEURISTIC.PARALLEL"));
+			}
+		}
+		/* else the scan runs in this process and reports only the blocks and records of the level */
 	} else if (cli_present("HEURISTIC.ARSAMPLE") == CLI_PRESENT || cli_present("HEURISTIC.IMPSAMPLE") == CLI_PRESENT)
 	{
 		if (cli_present("HEURISTIC.ARSAMPLE") == CLI_PRESENT)
@@ -193,7 +204,7 @@ void mupip_size(void)
 		switch (mupip_size_cfg.heuristic)
 		{
 		case scan:
-			status |= mu_size_scan(gl_ptr, mupip_size_cfg.level);
+			status |= mu_size_scan(gl_ptr, mupip_size_cfg.level, mupip_size_cfg.parallel);
 			break;
 		case arsample:
 			status |= mu_size_arsample(gl_ptr, mupip_size_cfg.samples, mupip_size_cfg.seed);
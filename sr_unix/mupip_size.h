@@ -18,11 +18,12 @@
 void mupip_size(void);
 int4 mu_size_arsample(glist *gl_ptr, uint M, int seed);
 int4 mu_size_impsample(glist *gl_ptr, int4 M, int4 seed);
-int4 mu_size_scan(glist *gl_ptr, int4 level);
+int4 mu_size_scan(glist *gl_ptr, int4 level, int4 nworkers);
 enum cdb_sc mu_size_rand_traverse(double *r, double *a);
 
 #define EPS			1e-6
 #define MAX_RECS_PER_BLK	65535
+#define MAX_SIZE_WORKERS	64	/* HEURISTIC=PARALLEL limit */
 #define ROUND(X)		((int)((X) + 0.5)) /* c89 does not have round() and some Solaris machines uses that compiler */
 #define SQR(X)			((double)(X) * (double)(X))
 
@@ -462,6 +462,9 @@ void	op_fnzpeek(mval *structid, int offset, int len, mval *format, mval *ret)
 	unsigned char		argument_uc_buf[ARGUMENT_MAX_LEN];
 	sgmnt_addrs		*csa;
 	int			pass;
+	gvstats_rec_t		nl_gvstats;
+	char			*nl_buf = NULL;
+	int			gvs_off, gvs_end, ovl_off;
 	DCL_THREADGBL_ACCESS;
 
 	SETUP_THREADGBL_ACCESS;
@@ -699,6 +702,26 @@ void	op_fnzpeek(mval *structid, int offset, int len, mval *format, mval *ret)
 	zpeekadr = (void *)((char *)zpeekadr + offset);
 	if ((0 > len) || (MAX_STRLEN < len))
 		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_BADZPEEKARG, 2, RTS_ERROR_LITERAL("length"));
+	gvs_off = OFFSETOF(node_local, gvstats_rec);
+	gvs_end = gvs_off + SIZEOF(gvstats_rec_t);
+	if ((PO_NLREG == mnemonic_opcode) && (offset < gvs_end) && ((offset + len) > gvs_off))
+	{	/* The database wide statistics accumulate in per-process-slot shards (see gvstats_rec.h) so what is in
+		 * node_local.gvstats_rec is only where they started. Add them up in private storage and serve the part of
+		 * the peek that falls on node_local.gvstats_rec from there.
+		 */
+		gvstats_rec_cnl_sum((&FILE_INFO(r_ptr)->s_addrs)->nl, &nl_gvstats);
+		if ((gvs_off <= offset) && ((offset + len) <= gvs_end))
+			zpeekadr = (char *)&nl_gvstats + (offset - gvs_off);
+		else if ((offset + len) <= SIZEOF(node_local))
+		{	/* Straddles gvstats_rec and neighboring fields which are all within node_local so safe to copy */
+			nl_buf = (char *)malloc(len);
+			memcpy(nl_buf, zpeekadr, len);
+			ovl_off = MAX(offset, gvs_off);
+			memcpy(nl_buf + (ovl_off - offset), (char *)&nl_gvstats + (ovl_off - gvs_off),
+				MIN(offset + len, gvs_end) - ovl_off);
+			zpeekadr = nl_buf;
+		}
+	}
 	if (1 < format->str.len)
 		rts_error_csa(CSA_ARG(NULL) VARLSTCNT(4) ERR_BADZPEEKARG, 2, RTS_ERROR_LITERAL("format"));
 	else if (1 == format->str.len)
@@ -737,6 +760,8 @@ void	op_fnzpeek(mval *structid, int offset, int len, mval *format, mval *ret)
 	 * mval is updated to point to the return string. Even errors return here so these sigactions can be reversed.
 	 */
 	errtoraise = op_fnzpeek_stpcopy(zpeekadr, len, ret, fmtcode);
+	if (NULL != nl_buf)
+		free(nl_buf);
 	/* Can restore handlers now that access verified */
 	sigaction(SIGBUS, &prev_action_bus, NULL);
 	sigaction(SIGSEGV, &prev_action_segv, NULL);
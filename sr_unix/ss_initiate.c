@@ -224,13 +224,13 @@ boolean_t	ss_initiate(gd_region *reg, 			/* Region in which snapshot has to be s
 	void			*ss_shmaddr;
 	intrpt_state_t		prev_intrpt_state;
 
-	assert(IS_MUPIP_IMAGE);
+	assert(IS_MUPIP_IMAGE || IS_MUMPS_IMAGE);	/* MUPIP INTEG or VIEW "SNAPSHOT" (ss_snapshot_read_begin) */
 	assert(NULL != calling_utility);
 	csa = &FILE_INFO(reg)->s_addrs;
 	csd = csa->hdr;
 	cnl = csa->nl;
 	acc_meth = csd->acc_meth;
-	debug_mupip = (CLI_PRESENT == cli_present("DBG"));
+	debug_mupip = IS_MUPIP_IMAGE && (CLI_PRESENT == cli_present("DBG"));
 	/* Create a context containing default information pertinent to this initiate invocation */
 	lcl_ss_ctx = malloc(SIZEOF(snapshot_context_t)); /* should be free'd by ss_release */
 	DEFAULT_INIT_SS_CTX(lcl_ss_ctx);
@@ -240,7 +240,7 @@ boolean_t	ss_initiate(gd_region *reg, 			/* Region in which snapshot has to be s
 	 */
 	lcl_ss_ctx->cur_state = BEFORE_SHADOW_FIL_CREAT;
 	*ss_ctx = lcl_ss_ctx;
-	assert(!csa->now_crit);	/* Right now mu_int_reg (which does not hold crit) is the only one that calls ss_initiate */
+	assert(!csa->now_crit);	/* Neither mu_int_reg nor ss_snapshot_read_begin hold crit when they call ss_initiate */
 	assert(!csa->hold_onto_crit);	/* this ensures we can safely do unconditional grab_crit and rel_crit */
 	ss_get_lock(reg);	/* Grab hold of the snapshot crit lock (low level latch) */
 	ss_shm_ptr = (shm_snapshot_ptr_t)SS_GETSTARTPTR(csa);
@@ -36,6 +36,7 @@
 #include "shmpool.h"
 #include "db_snapshot.h"
 #include "mupip_exit.h"
+#include "gtmimagename.h"
 
 error_def(ERR_INTEGERRS);
 error_def(ERR_SSFILOPERR);
@@ -68,6 +69,14 @@ void	ss_read_block(snapshot_context_ptr_t lcl_ss_ctx, block_id blk, sm_uc_ptr_t
 	LSEEKREAD(lcl_ss_ctx->shdw_fd, blk_offset, (uchar_ptr_t) blk_buff_ptr, blk_size, pread_res);
 	if (0 != pread_res)
 	{
+		if (IS_MUMPS_IMAGE)
+		{	/* VIEW "SNAPSHOT" reader (ss_snapshot_read); the error goes to the M program rather than ending an INTEG */
+			if (-1 == pread_res)
+				rts_error_csa(CSA_ARG(csa) VARLSTCNT(7) ERR_SSPREMATEOF, 5, blk, blk_size, blk_offset,
+					LEN_AND_STR(ss_shm_ptr->ss_info.shadow_file));
+			rts_error_csa(CSA_ARG(csa) VARLSTCNT(7) ERR_SSFILOPERR, 4, LEN_AND_LIT("read"),
+				LEN_AND_STR(ss_shm_ptr->ss_info.shadow_file), pread_res);
+		}
 		if (-1 == pread_res)
 		{
 			gtm_putmsg_csa(CSA_ARG(csa) VARLSTCNT(7) ERR_SSPREMATEOF, 5, blk, blk_size, blk_offset,
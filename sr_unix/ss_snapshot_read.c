@@ -0,0 +1,251 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include "gtm_string.h"
+#include "gtm_stdlib.h"
+
+#include "gdsroot.h"
+#include "gdskill.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsblk.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "gdscc.h"
+#include "jnl.h"
+#include "buddy_list.h"		/* needed for tp.h */
+#include "hashtab_int4.h"	/* needed for tp.h */
+#include "tp.h"			/* for RESET_ALL_GVT_CLUES_REG */
+#include "cdb_sc.h"
+#include "eintr_wrappers.h"
+#include "gtmio.h"
+#include "gtmcrypt.h"
+#include "min_max.h"
+#include "shmpool.h"
+#include "db_snapshot.h"
+
+GBLREF	sgmnt_addrs		*cs_addrs;
+GBLREF	gd_region		*gv_cur_region;
+GBLREF	uint4			dollar_tlevel;
+GBLREF	unsigned char		rdfail_detail;
+GBLREF	void			(*call_on_signal)();
+
+error_def(ERR_DBFILERR);
+error_def(ERR_REGSSFAIL);
+error_def(ERR_SNAPSHOTFAIL);
+error_def(ERR_SNAPSHOTNOTALLOWED);
+error_def(ERR_SSV4NOALLOW);
+error_def(ERR_TEXT);
+
+#define	SS_READ_BUFFS_INIT	16	/* block buffers allocated by the first ss_snapshot_read; doubled whenever they run out */
+
+/* VIEW "SNAPSHOT" support. ss_snapshot_read_begin starts a snapshot of the current region exactly as MUPIP INTEG -ONLINE does
+ * (ss_initiate) except that the process starting it is an M process, which then keeps the snapshot for as long as it wants.
+ * From then on t_qread hands every block of the region to ss_snapshot_read, which returns the block as it was at the
+ * snapshot transaction number: the before image from the shadow file if an update has since written one, and the block
+ * from the database file otherwise. Blocks are read into process private buffers rather than the global buffers, so they
+ * never change under the reader and t_end has nothing to validate; reads of the region neither restart nor take crit on
+ * account of concurrent updates. The same holds in TP (tp_hist and tp_tend skip the region), so a read-only TP transaction
+ * over such regions sees all of them as of their snapshots and commits on its first try without ever taking crit. Updates to
+ * the region are rejected while it is read this way, since there is no consistent way to apply them to a past state of the
+ * database.
+ */
+void ss_snapshot_read_begin(void)
+{
+	gd_region		*reg;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	snapshot_read_t		*ssr;
+	util_snapshot_t		util_ss;
+	boolean_t		started;
+
+	reg = gv_cur_region;
+	csa = cs_addrs;
+	csd = csa->hdr;
+	if (NULL != csa->ss_read)
+		return;		/* already reading this region through a snapshot; keep that one */
+	if (dollar_tlevel)
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(8) ERR_SNAPSHOTFAIL, 2, REG_LEN_STR(reg),
+			ERR_TEXT, 2, LEN_AND_LIT("Cannot start a snapshot inside a TP transaction"));
+	if (reg->read_only)	/* a snapshot needs to flush the global buffers (see ss_initiate) */
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(8) ERR_SNAPSHOTFAIL, 2, REG_LEN_STR(reg),
+			ERR_TEXT, 2, LEN_AND_LIT("Process does not have write access to the database"));
+	if (!csd->fully_upgraded)
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(8) ERR_SNAPSHOTFAIL, 2, REG_LEN_STR(reg), ERR_SSV4NOALLOW, 2, DB_LEN_STR(reg));
+	/* ss_initiate allocates a fresh context for the snapshot it starts. Give up the one gvcst_init set up for taking part
+	 * in the snapshots of other processes; ss_snapshot_read_end puts it back.
+	 */
+	assert(NULL != csa->ss_ctx);
+	ss_destroy_context(SS_CTX_CAST(csa->ss_ctx));
+	free(csa->ss_ctx);
+	csa->ss_ctx = NULL;
+	util_ss.header = (sgmnt_data_ptr_t)malloc(SGMNT_HDR_LEN);
+	util_ss.master_map = (unsigned char *)malloc(MASTER_MAP_SIZE_MAX);
+	util_ss.native_size = 0;
+	started = ss_initiate(reg, &util_ss, (snapshot_context_ptr_t *)&csa->ss_ctx, FALSE, "VIEW SNAPSHOT");
+	free(util_ss.header);
+	free(util_ss.master_map);
+	if (!started || (NULL == csa->ss_ctx))
+	{	/* ss_initiate has reported why. It returns TRUE having released the snapshot if it found the database
+		 * not fully upgraded once it had crit.
+		 */
+		if (NULL != csa->ss_ctx)
+			ss_release((snapshot_context_ptr_t *)&csa->ss_ctx);
+		call_on_signal = NULL;
+		csa->ss_ctx = malloc(SIZEOF(snapshot_context_t));
+		DEFAULT_INIT_SS_CTX((SS_CTX_CAST(csa->ss_ctx)));
+		CLEAR_SNAPSHOTS_IN_PROG(csa);
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(4) ERR_SNAPSHOTFAIL, 2, REG_LEN_STR(reg));
+	}
+	ssr = (snapshot_read_t *)malloc(SIZEOF(snapshot_read_t));
+	memset(ssr, 0, SIZEOF(snapshot_read_t));
+	ssr->snapshot_tn = SS_CTX_CAST(csa->ss_ctx)->ss_shm_ptr->ss_info.snapshot_tn;
+	/* Roots and clues found so far describe the current database; find them again in the snapshot */
+	RESET_ALL_GVT_CLUES_REG(csa);
+	csa->ss_read = ssr;
+}
+
+/* Ends VIEW "SNAPSHOT" for the current region: releases the snapshot and goes back to reading the region through the global
+ * buffers.
+ */
+void ss_snapshot_read_end(void)
+{
+	gd_region		*reg;
+	sgmnt_addrs		*csa;
+	snapshot_read_t		*ssr;
+
+	reg = gv_cur_region;
+	csa = cs_addrs;
+	if (NULL == (ssr = csa->ss_read))
+		return;
+	if (dollar_tlevel)
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(6) ERR_SNAPSHOTNOTALLOWED, 4,
+			LEN_AND_LIT("VIEW \"NOSNAPSHOT\" inside a TP transaction"), REG_LEN_STR(reg));
+	csa->ss_read = NULL;
+	RESET_ALL_GVT_CLUES_REG(csa);
+	ss_snapshot_read_free(ssr);
+	ss_release((snapshot_context_ptr_t *)&csa->ss_ctx);
+	assert(NULL == csa->ss_ctx);
+	csa->ss_ctx = malloc(SIZEOF(snapshot_context_t));
+	DEFAULT_INIT_SS_CTX((SS_CTX_CAST(csa->ss_ctx)));
+	CLEAR_SNAPSHOTS_IN_PROG(csa);
+}
+
+/* Frees the block buffers of a VIEW "SNAPSHOT" reader; also called by gds_rundown, which leaves the snapshot itself to the
+ * orphaned snapshot cleanup as this process is its initiator.
+ */
+void ss_snapshot_read_free(snapshot_read_t *ssr)
+{
+	int	i;
+
+	for (i = 0; i < ssr->nbuffs; i++)
+		free(ssr->free_buffs[i]);
+	if (NULL != ssr->buffs)
+	{
+		free(ssr->buffs);
+		free(ssr->free_buffs);
+	}
+	free(ssr);
+}
+
+/* Called by t_qread for a region in VIEW "SNAPSHOT" mode. Returns a process private copy of block "blk" as of the snapshot,
+ * or NULL (with rdfail_detail set) if the block is beyond the end of the database as it was then. Each call hands out a new
+ * buffer so that the blocks of the history of the current transaction stay put; t_begin makes them all available again.
+ */
+sm_uc_ptr_t ss_snapshot_read(block_id blk)
+{
+	boolean_t		use_new_key;
+	char			*in;
+	gd_segment		*seg;
+	int			gtmcrypt_errno, i, in_len, nbuffs, save_errno, size;
+	sgmnt_addrs		*csa;
+	sgmnt_data_ptr_t	csd;
+	shm_snapshot_ptr_t	ss_shm_ptr;
+	sm_uc_ptr_t		buff, *buffs;
+	snapshot_read_t		*ssr;
+	uchar_ptr_t		*free_buffs;
+	unix_db_info		*udi;
+
+	csa = cs_addrs;
+	csd = csa->hdr;
+	ssr = csa->ss_read;
+	assert(NULL != ssr);
+	ss_shm_ptr = SS_CTX_CAST(csa->ss_ctx)->ss_shm_ptr;
+	DBG_ENSURE_PTR_WITHIN_SS_BOUNDS(csa, (sm_uc_ptr_t)ss_shm_ptr);
+	if (ss_shm_ptr->failure_errno)
+	{	/* An updater could not write its before images, so the snapshot no longer describes a past state. As in
+		 * mu_int_read, it is okay to check this outside crit.
+		 */
+		rts_error_csa(CSA_ARG(csa) VARLSTCNT(7) ERR_REGSSFAIL, 4, ss_shm_ptr->failed_pid, ss_shm_ptr->failure_errno,
+			DB_LEN_STR(gv_cur_region), ss_shm_ptr->failure_errno);
+	}
+	if (blk >= ss_shm_ptr->ss_info.total_blks)
+	{
+		rdfail_detail = cdb_sc_blknumerr;
+		return (sm_uc_ptr_t)NULL;
+	}
+	size = csd->blk_size;
+	if (ssr->used == ssr->nbuffs)
+	{
+		nbuffs = ssr->nbuffs ? (2 * ssr->nbuffs) : SS_READ_BUFFS_INIT;
+		buffs = (sm_uc_ptr_t *)malloc(SIZEOF(sm_uc_ptr_t) * nbuffs);
+		free_buffs = (uchar_ptr_t *)malloc(SIZEOF(uchar_ptr_t) * nbuffs);
+		if (ssr->nbuffs)
+		{
+			memcpy(buffs, ssr->buffs, SIZEOF(sm_uc_ptr_t) * ssr->nbuffs);
+			memcpy(free_buffs, ssr->free_buffs, SIZEOF(uchar_ptr_t) * ssr->nbuffs);
+			free(ssr->buffs);
+			free(ssr->free_buffs);
+		}
+		for (i = ssr->nbuffs; i < nbuffs; i++)
+		{	/* OS page aligned in case the database file is opened with O_DIRECT */
+			free_buffs[i] = (uchar_ptr_t)malloc(size + OS_PAGE_SIZE);
+			buffs[i] = (sm_uc_ptr_t)ROUND_UP2((UINTPTR_T)free_buffs[i], OS_PAGE_SIZE);
+		}
+		ssr->buffs = buffs;
+		ssr->free_buffs = free_buffs;
+		ssr->nbuffs = nbuffs;
+	}
+	buff = ssr->buffs[ssr->used++];
+	if (!ss_get_block(csa, blk, buff))
+	{
+		udi = FILE_INFO(gv_cur_region);
+		DB_LSEEKREAD(udi, udi->fd, (BLK_ZERO_OFF(csd->start_vbn) + (off_t)blk * size), buff, size, save_errno);
+		if (0 != save_errno)
+			rts_error_csa(CSA_ARG(csa) VARLSTCNT(5) ERR_DBFILERR, 2, DB_LEN_STR(gv_cur_region), save_errno);
+		/* An update may have written the before image (and then the new block) while we were reading; the before
+		 * image, if there now is one, is the version we want.
+		 */
+		ss_get_block(csa, blk, buff);
+	}
+	if (USES_ENCRYPTION(csd->is_encrypted))
+	{
+		in_len = MIN(size, ((blk_hdr_ptr_t)buff)->bsiz) - SIZEOF(blk_hdr);
+		use_new_key = NEEDS_NEW_KEY(csd, ((blk_hdr_ptr_t)buff)->tn);
+		if ((use_new_key || IS_ENCRYPTED(csd->is_encrypted)) && IS_BLK_ENCRYPTED(((blk_hdr_ptr_t)buff)->levl, in_len))
+		{
+			in = (char *)(buff + SIZEOF(blk_hdr));
+			GTMCRYPT_DECRYPT(csa, (use_new_key ? TRUE : csd->non_null_iv),
+					(use_new_key ? csa->encr_key_handle2 : csa->encr_key_handle),
+					in, in_len, NULL, buff, SIZEOF(blk_hdr), gtmcrypt_errno);
+			if (0 != gtmcrypt_errno)
+			{
+				seg = gv_cur_region->dyn.addr;
+				GTMCRYPT_REPORT_ERROR(gtmcrypt_errno, rts_error, seg->fname_len, seg->fname);
+			}
+		}
+	}
+	return buff;
+}
@@ -47,6 +47,7 @@
 #include "wcs_phase2_commit_wait.h"
 #include "wbox_test_init.h"
 #include "wcs_mm_recover.h"
+#include "wcs_mm_msync.h"
 #include "memcoherency.h"
 #include "gtm_c_stack_trace.h"
 #include "anticipatory_freeze.h"
@@ -439,7 +440,7 @@ boolean_t wcs_flu(uint4 options)
 			#ifdef _AIX
 			GTM_DB_FSYNC(csa, udi->fd, rc);
 			#else
-			rc = MSYNC((caddr_t)(MM_BASE_ADDR(csa)), (caddr_t)csa->db_addrs[1]);
+			rc = wcs_mm_msync(csa);
 			#endif
 			if (!(WBTEST_ENABLED(WBTEST_WCS_FLU_FAIL)) && (0 == rc))
 			{	/* Save when did last full sync */
@@ -0,0 +1,109 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#include "mdef.h"
+
+#include <sys/mman.h>
+
+#include "gtm_unistd.h"	/* DB_FSYNC needs this */
+
+#include "gdsroot.h"
+#include "gtm_facility.h"
+#include "fileinfo.h"
+#include "gdsbt.h"
+#include "gdsfhead.h"
+#include "filestruct.h"
+#include "jnl.h"
+#include "anticipatory_freeze.h"
+#include "eintr_wrappers.h"
+#include "min_max.h"
+#include "wcs_mm_msync.h"
+
+/* An MM database is updated in place through its mapping, so the kernel writes the changes to the file whenever it likes and
+ * a flush (wcs_flu, gds_rundown) has to msync the mapping to be sure they are on disk. msync of the whole mapping walks
+ * every page of the file even when only a few were updated, so mm_update notes the parts of the file it updates here
+ * (cnl->mm_dirty[], in 2MB granules so that ranges stay few and aligned to huge pages) and wcs_mm_msync msyncs just
+ * those. Updates and flushes both happen in crit, which protects the ranges. Once MM_DIRTY_RANGES do not cover the updates
+ * (scattered updates to a large file) a full msync is as cheap as any and the ranges give way to MM_DIRTY_ALL.
+ */
+void wcs_mm_dirty(sgmnt_addrs *csa, block_id blk)
+{
+	int4			cnt;
+	mm_dirty_range_t	*range, *range_top;
+	node_local_ptr_t	cnl;
+	uint4			granule;
+
+	assert(csa->now_crit);
+	cnl = csa->nl;
+	cnt = cnl->mm_dirty_cnt;
+	if (MM_DIRTY_ALL == cnt)
+		return;
+	assert((0 <= cnt) && (MM_DIRTY_RANGES >= cnt));
+	granule = (uint4)(((gtm_uint64_t)blk * csa->hdr->blk_size) >> MM_DIRTY_GRANULE_SHIFT);
+	range_top = &cnl->mm_dirty[cnt];
+	for (range = range_top - 1; range >= cnl->mm_dirty; range--)	/* latest range first as updates tend to be close */
+	{
+		if ((granule + 1 < range->first) || (granule > range->last + 1))
+			continue;
+		if (granule < range->first)
+			range->first = granule;
+		else if (granule > range->last)
+			range->last = granule;
+		return;
+	}
+	if (MM_DIRTY_RANGES == cnt)
+	{
+		cnl->mm_dirty_cnt = MM_DIRTY_ALL;
+		return;
+	}
+	range_top->first = range_top->last = granule;
+	cnl->mm_dirty_cnt = cnt + 1;
+}
+
+/* msync the parts of the file noted by wcs_mm_dirty and forget them. Called in crit (or by the last process to run the region
+ * down). If another process extended the file and this one has not remapped it yet, updates past the end of this process'
+ * mapping cannot be msync'ed through it, so the file gets an fsync instead. Returns 0 or -1 (with errno set) like msync.
+ */
+int wcs_mm_msync(sgmnt_addrs *csa)
+{
+	int4			cnt;
+	int			rc;
+	mm_dirty_range_t	*range, *range_top;
+	node_local_ptr_t	cnl;
+	sm_uc_ptr_t		base, end, start;
+
+	cnl = csa->nl;
+	cnt = cnl->mm_dirty_cnt;
+	base = MM_BASE_ADDR(csa);
+	rc = 0;
+	if (csa->total_blks != csa->ti->total_blks)
+	{
+		GTM_DB_FSYNC(csa, FILE_INFO(csa->region)->fd, rc);
+	} else if (MM_DIRTY_ALL == cnt)
+		rc = MSYNC((caddr_t)base, (caddr_t)csa->db_addrs[1]);
+	else
+	{
+		assert((0 <= cnt) && (MM_DIRTY_RANGES >= cnt));
+		for (range = cnl->mm_dirty, range_top = range + cnt; (0 == rc) && (range < range_top); range++)
+		{
+			start = base + ((gtm_uint64_t)range->first << MM_DIRTY_GRANULE_SHIFT);
+			if (start >= csa->db_addrs[1])
+				continue;	/* the file was truncated (MUPIP REORG -TRUNCATE) since */
+			end = base + ((gtm_uint64_t)(range->last + 1) << MM_DIRTY_GRANULE_SHIFT);
+			end = MIN(end, csa->db_addrs[1]);
+			rc = MSYNC((caddr_t)start, (caddr_t)end);
+		}
+	}
+	if (0 == rc)
+		cnl->mm_dirty_cnt = 0;
+	return rc;
+}
@@ -0,0 +1,19 @@
+/****************************************************************
+ *								*
+ * Copyright (c) 2026 YottaDB LLC and/or its subsidiaries.	*
+ * All rights reserved.						*
+ *								*
+ *	This source code contains the intellectual property	*
+ *	of its copyright holder(s), and is made available	*
+ *	under a license.  If you do not know the terms of	*
+ *	the license, please stop and do not read further.	*
+ *								*
+ ****************************************************************/
+
+#ifndef WCS_MM_MSYNC_H_INCLUDED
+#define WCS_MM_MSYNC_H_INCLUDED
+
+void	wcs_mm_dirty(sgmnt_addrs *csa, block_id blk);
+int	wcs_mm_msync(sgmnt_addrs *csa);
+
+#endif
@@ -15,22 +15,35 @@
 
 	.include "g_msf.si"
 	.include "linkage.si"
+	.include "mval_def.si"
 #	include "debug.si"
 #
 # op_numcmp calls numcmp to compare two mvals
 #
 # entry:
 #   rax	- mval *u
-#   rdx	- mval *v
+#   r10	- mval *v
 #
 # exit:
 #   condition codes set according to value of numcmp(u, v)
+#
+# When both mvals have integer representations, compare them directly rather than calling numcmp. Generated code only
+# tests the result with signed conditional jumps, which see the same outcome from comparing the two m[1] values as
+# from comparing the -1/0/1 returned by numcmp against 0.
 #
 
 	.text
 	.extern	numcmp
 
 ENTRY	op_numcmp
+	movw	mval_w_mvtype(%rax), %r11w
+	andw	mval_w_mvtype(%r10), %r11w
+	testw	$mval_m_int_without_nm, %r11w	# Both integer representations?
+	je	l1
+	movl	mval_l_m1(%rax), %r11d
+	cmpl	mval_l_m1(%r10), %r11d		# Set flags according to u compared to v
+	ret
+l1:
 	subq	$8, %rsp			# Bump stack for 16 byte alignment
 	CHKSTKALIGN				# Verify stack alignment
 	movq	%r10, %rsi